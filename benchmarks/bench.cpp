@@ -0,0 +1,396 @@
+#include "propp/Property.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace propp;
+
+// Latency of read, write and `+=` of every property alias, getter and setter type against raw `int` and
+// `std::atomic<int>`, their size and throughput of MT properties at 1..N threads. Prints JSON by default,
+// so results of two builds can be compared by a script.
+// Usage: propp_bench [--table] [--filter=substring] [--min-time=ms] [--repetitions=N] [--threads=N]
+
+struct Options {
+    bool table = false;
+    std::string filter;
+    double minTimeMs = 20;
+    int repetitions = 5;
+    int maxThreads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+};
+
+struct ThreadResult {
+    int threads;
+    double readOpsPerSec;
+    double writeOpsPerSec;
+};
+
+struct Result {
+    std::string name;
+    std::size_t size;
+    double readNs;
+    double writeNs;     // negative for read-only properties
+    double compoundNs;
+    std::vector<ThreadResult> scaling;
+};
+
+// Keeps the compiler from dropping reads or hoisting them out of the loop
+#if defined(__GNUC__) || defined(__clang__)
+template <typename T>
+inline void DoNotOptimize(const T& value) { asm volatile("" : : "r,m"(value) : "memory"); }
+inline void ClobberMemory() { asm volatile("" : : : "memory"); }
+#else
+inline const volatile void* g_Sink;
+template <typename T>
+inline void DoNotOptimize(const T& value) { g_Sink = &value; std::atomic_signal_fence(std::memory_order_seq_cst); }
+inline void ClobberMemory() { std::atomic_signal_fence(std::memory_order_seq_cst); }
+#endif
+
+// Property under test with getter and setter bound to it the way owners usually do, getter reads and
+// setter assigns the property itself
+template <typename P>
+struct Fixture {
+    P property;
+
+    Fixture() : property(Make(this)) {}
+
+    static P Make(Fixture* self) {
+        constexpr bool HasGetter = !std::is_same_v<typename P::Getter, NoGetter>;
+        constexpr bool HasSetter = !std::is_same_v<typename P::Setter, NoSetter>;
+        if constexpr (HasGetter && HasSetter) {
+            return P(0, MakeGetter(self), MakeSetter(self));
+        } else if constexpr (HasGetter) {
+            return P(0, MakeGetter(self));
+        } else if constexpr (HasSetter) {
+            return P(0, MakeSetter(self));
+        } else {
+            return P(0);
+        }
+    }
+
+    // Functor bindings are stateless and default constructed
+    static typename P::Getter MakeGetter(Fixture* self) {
+        if constexpr (detail::IsFunctorGetter<typename P::Getter>) {
+            return {};
+        } else {
+            return [self]() -> decltype(auto) { return self->property(); };
+        }
+    }
+
+    static typename P::Setter MakeSetter(Fixture* self) {
+        if constexpr (detail::IsFunctorSetter<typename P::Setter>) {
+            return {};
+        } else {
+            return [self](const int& value) {
+                if constexpr (!P::IsReadOnly) {
+                    self->property = value;
+                }
+            };
+        }
+    }
+
+    int Read() {
+        if constexpr (P::IsSnapshot) {
+            return *property();
+        } else {
+            return static_cast<int>(property);
+        }
+    }
+    void Write(int value) { property = value; }
+    void Compound() { property += 1; }
+
+    static constexpr bool ReadOnly = P::IsReadOnly;
+    static constexpr bool ThreadSafe = !std::is_same_v<typename P::BaseLock, NoLock>;
+    static constexpr bool SingleWriter = P::IsBuffered;
+};
+
+template <>
+struct Fixture<int> {
+    int property = 0;
+
+    int Read() { return property; }
+    void Write(int value) { property = value; }
+    void Compound() { property += 1; }
+
+    static constexpr bool ReadOnly = false;
+    static constexpr bool ThreadSafe = false;
+    static constexpr bool SingleWriter = false;
+};
+
+template <>
+struct Fixture<std::atomic<int>> {
+    std::atomic<int> property{0};
+
+    int Read() { return property; }
+    void Write(int value) { property = value; }
+    void Compound() { property += 1; }
+
+    static constexpr bool ReadOnly = false;
+    static constexpr bool ThreadSafe = true;
+    static constexpr bool SingleWriter = false;
+};
+
+// Owner with getter and setter bound to its member functions by GetterTypeMethod and SetterTypeMethod, same
+// work as the closures of Fixture, so the cases show the cost of std::function against a direct call
+template <bool ThreadSafe>
+struct MethodOwner {
+    int Get() const { return property(); }
+    void Set(int value) { property = value; }
+
+    Property<int, false, ThreadSafe, GetterTypeMethod<&MethodOwner::Get>, SetterTypeMethod<&MethodOwner::Set>> property{0, this, this};
+};
+
+template <bool MT>
+struct Fixture<MethodOwner<MT>> {
+    MethodOwner<MT> owner;
+
+    int Read() { return static_cast<int>(owner.property); }
+    void Write(int value) { owner.property = value; }
+    void Compound() { owner.property += 1; }
+
+    static constexpr bool ReadOnly = false;
+    static constexpr bool ThreadSafe = MT;
+    static constexpr bool SingleWriter = false;
+};
+
+// Median time of one operation in nanoseconds. Iteration count doubles until a run takes `minTimeMs`
+template <typename Operation>
+double Measure(const Options& options, Operation&& operation)
+{
+    using Clock = std::chrono::steady_clock;
+    std::size_t iterations = 1024;
+    for (;;) {
+        const auto begin = Clock::now();
+        for (std::size_t i = 0; i < iterations; ++i) {
+            operation(i);
+        }
+        const double ms = std::chrono::duration<double, std::milli>(Clock::now() - begin).count();
+        if (ms >= options.minTimeMs || iterations >= (std::size_t(1) << 34)) {
+            break;
+        }
+        iterations *= 2;
+    }
+
+    std::vector<double> samples;
+    for (int r = 0; r < options.repetitions; ++r) {
+        const auto begin = Clock::now();
+        for (std::size_t i = 0; i < iterations; ++i) {
+            operation(i);
+        }
+        samples.push_back(std::chrono::duration<double, std::nano>(Clock::now() - begin).count() / iterations);
+    }
+    std::sort(samples.begin(), samples.end());
+    return samples[samples.size() / 2];
+}
+
+// Operations per second of `threads` threads running `operation` on one shared property for `minTimeMs`
+template <typename F, typename Operation>
+double Throughput(const Options& options, F& fixture, int threads, Operation operation)
+{
+    std::atomic<int> ready(0);
+    std::atomic<bool> start(false);
+    std::atomic<bool> stop(false);
+    std::atomic<unsigned long long> total(0);
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            ready.fetch_add(1);
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            unsigned long long count = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                for (int k = 0; k < 256; ++k) {
+                    operation(fixture, t + k);
+                }
+                count += 256;
+            }
+            total.fetch_add(count);
+        });
+    }
+
+    while (ready.load() != threads) {
+        std::this_thread::yield();
+    }
+    const auto begin = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(options.minTimeMs * options.repetitions));
+    stop.store(true);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    return total.load() / seconds;
+}
+
+template <typename P>
+void Run(const Options& options, std::vector<Result>& results, const char* name)
+{
+    if (!options.filter.empty() && std::strstr(name, options.filter.c_str()) == nullptr) {
+        return;
+    }
+    using F = Fixture<P>;
+    F fixture;
+
+    Result result;
+    result.name = name;
+    result.size = sizeof(P);
+    result.readNs = Measure(options, [&](std::size_t) { DoNotOptimize(fixture.Read()); });
+    result.writeNs = -1;
+    result.compoundNs = -1;
+    if constexpr (!F::ReadOnly) {
+        result.writeNs = Measure(options, [&](std::size_t i) { fixture.Write(static_cast<int>(i)); ClobberMemory(); });
+        result.compoundNs = Measure(options, [&](std::size_t) { fixture.Compound(); ClobberMemory(); });
+    }
+
+    if constexpr (F::ThreadSafe) {
+        for (int threads = 1; threads <= options.maxThreads; threads *= 2) {
+            ThreadResult scaling{threads, 0, -1};
+            scaling.readOpsPerSec = Throughput(options, fixture, threads, [](F& f, int) { DoNotOptimize(f.Read()); });
+            if constexpr (!F::ReadOnly) {
+                // Buffered properties allow one writer only
+                if (!F::SingleWriter || threads == 1) {
+                    scaling.writeOpsPerSec = Throughput(options, fixture, threads, [](F& f, int value) { f.Write(value); });
+                }
+            }
+            result.scaling.push_back(scaling);
+        }
+    }
+    results.push_back(std::move(result));
+}
+
+void PrintJson(const Options& options, const std::vector<Result>& results)
+{
+    auto number = [](double value) {
+        char buffer[32];
+        if (value < 0) {
+            return std::string("null");
+        }
+        std::snprintf(buffer, sizeof(buffer), "%.3f", value);
+        return std::string(buffer);
+    };
+
+    printf("{\n  \"config\": {\"min_time_ms\": %s, \"repetitions\": %d, \"max_threads\": %d, \"stats\": %d},\n",
+        number(options.minTimeMs).c_str(), options.repetitions, options.maxThreads, PROPP_ENABLE_STATS);
+    printf("  \"results\": [\n");
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        printf("    {\"name\": \"%s\", \"sizeof\": %zu, \"read_ns\": %s, \"write_ns\": %s, \"compound_ns\": %s, \"scaling\": [",
+            r.name.c_str(), r.size, number(r.readNs).c_str(), number(r.writeNs).c_str(), number(r.compoundNs).c_str());
+        for (std::size_t k = 0; k < r.scaling.size(); ++k) {
+            printf("%s{\"threads\": %d, \"read_ops_per_sec\": %s, \"write_ops_per_sec\": %s}", k ? ", " : "",
+                r.scaling[k].threads, number(r.scaling[k].readOpsPerSec).c_str(), number(r.scaling[k].writeOpsPerSec).c_str());
+        }
+        printf("]}%s\n", i + 1 < results.size() ? "," : "");
+    }
+    printf("  ]\n}\n");
+}
+
+void PrintTable(const std::vector<Result>& results)
+{
+    printf("%-56s %6s %10s %10s %10s  %s\n", "property", "sizeof", "read ns", "write ns", "+= ns", "threads: read/write Mops/s");
+    for (const Result& r : results) {
+        printf("%-56s %6zu %10.2f ", r.name.c_str(), r.size, r.readNs);
+        if (r.writeNs < 0) {
+            printf("%10s %10s ", "-", "-");
+        } else {
+            printf("%10.2f %10.2f ", r.writeNs, r.compoundNs);
+        }
+        for (const ThreadResult& scaling : r.scaling) {
+            printf(" %d: %.1f/", scaling.threads, scaling.readOpsPerSec / 1e6);
+            if (scaling.writeOpsPerSec < 0) {
+                printf("-");
+            } else {
+                printf("%.1f", scaling.writeOpsPerSec / 1e6);
+            }
+        }
+        printf("\n");
+    }
+}
+
+struct Twice { int operator()(const int& value) const { return value * 2; } };
+struct Clamp { int operator()(const int& value) const { return std::clamp(value, 0, 1 << 30); } };
+
+int main(int argc, char** argv)
+{
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--table") {
+            options.table = true;
+        } else if (arg.rfind("--filter=", 0) == 0) {
+            options.filter = arg.substr(9);
+        } else if (arg.rfind("--min-time=", 0) == 0) {
+            options.minTimeMs = std::atof(arg.c_str() + 11);
+        } else if (arg.rfind("--repetitions=", 0) == 0) {
+            options.repetitions = std::max(1, std::atoi(arg.c_str() + 14));
+        } else if (arg.rfind("--threads=", 0) == 0) {
+            options.maxThreads = std::max(1, std::atoi(arg.c_str() + 10));
+        } else {
+            fprintf(stderr, "Usage: %s [--table] [--filter=substring] [--min-time=ms] [--repetitions=N] [--threads=N]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::vector<Result> results;
+
+    // Baselines
+    Run<int>(options, results, "int");
+    Run<std::atomic<int>>(options, results, "std::atomic<int>");
+
+    // Single-threaded read-write
+    Run<PropertyRW<int>>(options, results, "PropertyRW<int>");
+    Run<PropertyRWG<int, GetterTypeValue<int>>>(options, results, "PropertyRWG<int, GetterTypeValue>");
+    Run<PropertyRWG<int, GetterTypeRef<int>>>(options, results, "PropertyRWG<int, GetterTypeRef>");
+    Run<PropertyRWS<int, SetterTypeValue<int>>>(options, results, "PropertyRWS<int, SetterTypeValue>");
+    Run<PropertyRWS<int, SetterTypeCRef<int>>>(options, results, "PropertyRWS<int, SetterTypeCRef>");
+    Run<PropertyRWGS<int, GetterTypeValue<int>, SetterTypeValue<int>>>(options, results, "PropertyRWGS<int, GetterTypeValue, SetterTypeValue>");
+    Run<PropertyRWGS<int, GetterTypeRef<int>, SetterTypeCRef<int>>>(options, results, "PropertyRWGS<int, GetterTypeRef, SetterTypeCRef>");
+    Run<PropertyRWGS<int, GetterTypeFunctor<Twice>, SetterTypeFunctor<Clamp>>>(options, results, "PropertyRWGS<int, GetterTypeFunctor, SetterTypeFunctor>");
+    Run<MethodOwner<false>>(options, results, "PropertyRWGS<int, GetterTypeMethod, SetterTypeMethod>");
+
+    // Multi-threaded read-write
+    Run<PropertyRWMT<int>>(options, results, "PropertyRWMT<int>");
+    Run<PropertyRWGMT<int, GetterTypeValue<int>>>(options, results, "PropertyRWGMT<int, GetterTypeValue>");
+    Run<PropertyRWGMT<int, GetterTypeRef<int>>>(options, results, "PropertyRWGMT<int, GetterTypeRef>");
+    Run<PropertyRWSMT<int, SetterTypeValue<int>>>(options, results, "PropertyRWSMT<int, SetterTypeValue>");
+    Run<PropertyRWSMT<int, SetterTypeCRef<int>>>(options, results, "PropertyRWSMT<int, SetterTypeCRef>");
+    Run<PropertyRWGSMT<int, GetterTypeValue<int>, SetterTypeValue<int>>>(options, results, "PropertyRWGSMT<int, GetterTypeValue, SetterTypeValue>");
+    Run<PropertyRWGSMT<int, GetterTypeRef<int>, SetterTypeCRef<int>>>(options, results, "PropertyRWGSMT<int, GetterTypeRef, SetterTypeCRef>");
+    Run<MethodOwner<true>>(options, results, "PropertyRWGSMT<int, GetterTypeMethod, SetterTypeMethod>");
+
+    // Read-only
+    Run<PropertyRO<int>>(options, results, "PropertyRO<int>");
+    Run<PropertyROG<int, GetterTypeValue<int>>>(options, results, "PropertyROG<int, GetterTypeValue>");
+    Run<PropertyROG<int, GetterTypeRef<int>>>(options, results, "PropertyROG<int, GetterTypeRef>");
+    Run<PropertyROS<int>>(options, results, "PropertyROS<int>");
+    Run<PropertyROGS<int>>(options, results, "PropertyROGS<int>");
+    Run<PropertyROMT<int>>(options, results, "PropertyROMT<int>");
+    Run<PropertyROGMT<int, GetterTypeValue<int>>>(options, results, "PropertyROGMT<int, GetterTypeValue>");
+    Run<PropertyROGMT<int, GetterTypeRef<int>>>(options, results, "PropertyROGMT<int, GetterTypeRef>");
+    Run<PropertyROSMT<int>>(options, results, "PropertyROSMT<int>");
+    Run<PropertyROGSMT<int>>(options, results, "PropertyROGSMT<int>");
+
+    // Lock policies
+    Run<PropertyRWAtomic<int>>(options, results, "PropertyRWAtomic<int>");
+    Run<PropertyRWSharedMT<int>>(options, results, "PropertyRWSharedMT<int>");
+    Run<PropertyRWSeqLock<int>>(options, results, "PropertyRWSeqLock<int>");
+    Run<PropertyRWSnapshot<int>>(options, results, "PropertyRWSnapshot<int>");
+    Run<PropertyDoubleBuffered<int>>(options, results, "PropertyDoubleBuffered<int>");
+    Run<PropertyTripleBuffered<int>>(options, results, "PropertyTripleBuffered<int>");
+    Run<PropertyRWMTPadded<int>>(options, results, "PropertyRWMTPadded<int>");
+
+    if (options.table) {
+        PrintTable(results);
+    } else {
+        PrintJson(options, results);
+    }
+    return EXIT_SUCCESS;
+}
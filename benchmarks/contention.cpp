@@ -0,0 +1,70 @@
+#include "propp/Property.hpp"
+#include "propp/Counter.hpp"
+#include <thread>
+#include <chrono>
+#include <vector>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace propp;
+
+// Measures throughput of `operator+=` on a single property shared by N threads and
+// verifies that no increments were lost.
+// Usage: propp_contention [max_threads] [increments_per_thread]
+
+struct Result {
+    double opsPerSec;
+    bool lost;
+};
+
+template <typename P>
+Result Run(int threads, int increments)
+{
+    P counter(0);
+    std::atomic<bool> start(false);
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+
+    for (int i = 0; i < threads; ++i) {
+        workers.emplace_back([&]() {
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            for (int k = 0; k < increments; ++k) {
+                counter += 1;
+            }
+        });
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    for (std::thread& t : workers) {
+        t.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double seconds = std::chrono::duration<double>(end - begin).count();
+    long long total = static_cast<long long>(threads) * increments;
+    return { total / seconds, static_cast<long long>(counter()) != total };
+}
+
+int main(int argc, char** argv)
+{
+    int maxThreads = argc > 1 ? std::atoi(argv[1]) : 64;
+    int increments = argc > 2 ? std::atoi(argv[2]) : 100000;
+    bool failed = false;
+
+    printf("%8s %24s %24s %24s\n", "threads", "PropertyRWMT ops/s", "PropertyRWAtomic ops/s", "PropertyCounter ops/s");
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        Result locked = Run<PropertyRWMT<int>>(threads, increments);
+        Result atomic = Run<PropertyRWAtomic<int>>(threads, increments);
+        Result counter = Run<PropertyCounter<int>>(threads, increments);
+        bool lost = locked.lost || atomic.lost || counter.lost;
+        printf("%8d %24.0f %24.0f %24.0f%s\n", threads, locked.opsPerSec, atomic.opsPerSec, counter.opsPerSec,
+            lost ? "  LOST UPDATES" : "");
+        failed = failed || lost;
+    }
+
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,64 @@
+#include "propp/Property.hpp"
+#include <thread>
+#include <chrono>
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace propp;
+
+// Measures throughput of N threads each incrementing its own property, with properties packed next to
+// each other and padded to whole cache lines.
+// Usage: propp_false_sharing [max_threads] [increments_per_thread]
+
+template <typename P>
+double Run(int threads, int increments)
+{
+    // Unique array keeps packed properties adjacent, as members of one struct would be
+    std::unique_ptr<P[]> counters(new P[threads]);
+    std::atomic<bool> start(false);
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+
+    for (int i = 0; i < threads; ++i) {
+        workers.emplace_back([&, i]() {
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            for (int k = 0; k < increments; ++k) {
+                counters[i] += 1;
+            }
+        });
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    for (std::thread& t : workers) {
+        t.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double seconds = std::chrono::duration<double>(end - begin).count();
+    return static_cast<double>(threads) * increments / seconds;
+}
+
+int main(int argc, char** argv)
+{
+    int maxThreads = argc > 1 ? std::atoi(argv[1]) : 16;
+    int increments = argc > 2 ? std::atoi(argv[2]) : 1000000;
+
+    printf("sizeof: PropertyRWMT<int> %zu, PropertyRWMTPadded<int> %zu, PropertyRWAtomic<int> %zu, PropertyRWAtomicPadded<int> %zu\n",
+        sizeof(PropertyRWMT<int>), sizeof(PropertyRWMTPadded<int>), sizeof(PropertyRWAtomic<int>), sizeof(PropertyRWAtomicPadded<int>));
+    printf("%8s %24s %24s %24s %24s\n", "threads", "RWMT ops/s", "RWMTPadded ops/s", "RWAtomic ops/s", "RWAtomicPadded ops/s");
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        printf("%8d %24.0f %24.0f %24.0f %24.0f\n", threads,
+            Run<PropertyRWMT<int>>(threads, increments),
+            Run<PropertyRWMTPadded<int>>(threads, increments),
+            Run<PropertyRWAtomic<int>>(threads, increments),
+            Run<PropertyRWAtomicPadded<int>>(threads, increments));
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -7,27 +7,8 @@
 using namespace propp;
 
 class Person {
-public:    
-   PropertyRO<std::string> Name;
-   PropertyRWSMT<int> Age;
-   PropertyROG<std::string, GetterTypeValue<std::string>> Address; // We declare getter that returns string by value
-    
-    Person(const std::string& name)
-       : Name(name)
-       , Age(0, [this](int value) { SetAge(value); })
-       , Address("123 Main St Mega City MS 12345", [this]() { return GetAddress(); })
-    {
-    }
-    
-    // For properties with custom getter and setter, we need to define copy constructor
-    Person(const Person& other)
-        : Name(other.Name())
-        , Age(other.Age(), [this](int value) { SetAge(value); })
-        , Address(other.Address.GetRaw(), [this]() { return GetAddress(); }) // Because we declared getter that returns string by value, we need to use GetRaw() to get the initial value
-    {
-    }
-
-private:    
+private:
+    // Member functions bound by relative getter and setter must be declared before the properties
     void SetAge(int value) {
         // Don't worry, inside setter you can assign value back with no recursion issue (if you do this in the same thread)
         Age = std::clamp(value, 0, 150);
@@ -40,6 +21,20 @@ private:
         // Don't worry that we call Address() inside getter, it won't cause recursion issue, next call will return the underlying value
         return Address() + predefinedCountry;
     }
+
+public:    
+   PropertyRO<std::string> Name;
+   PropertyRWSMT<int, SetterTypeRelative<&Person::SetAge>> Age;
+   PropertyROG<std::string, GetterTypeRelative<&Person::GetAddress>> Address; // Relative getter returns string by value
+    
+    // Relative getter and setter find the owner by offset, so Person is copyable and movable without
+    // hand-written copy constructor
+    Person(const std::string& name)
+       : Name(name)
+       , Age(0, this)
+       , Address("123 Main St Mega City MS 12345", this)
+    {
+    }
 };
 
 class Office {
@@ -66,7 +61,7 @@ int main()
     office.Persons().emplace_back(john);
 
     // Multithreading test, 50/50 chance that Age will be 50 or 100
-    Person john2(john); // Copy constructor will be called
+    Person john2(john); // Copy takes raw values without calling setter or getter, later calls go to john2, not john
 
     std::thread t1([&john2](){
         std::this_thread::sleep_for(std::chrono::milliseconds(rand() % 100));
@@ -0,0 +1,171 @@
+#pragma once
+
+#include "propp/Parallel.hpp"
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace propp {
+
+namespace detail {
+
+template <typename E, typename = void>
+struct HasRunPending : std::false_type {};
+
+template <typename E>
+struct HasRunPending<E, std::void_t<decltype(std::declval<E&>().RunPending())>> : std::true_type {};
+
+} // namespace detail
+
+// Setter `void(const T&)` that runs on an executor instead of the writer's thread. Write stores the value
+// right away and queues the setter, writes made before it runs are coalesced and it sees only the latest value.
+// Calls of one setter never overlap and run in write order. Setter must not assign the property, the value is
+// already stored. Executor is any object with Submit(std::function<void()>), e.g. ThreadPool, optional
+// RunPending() lets Flush() run queued tasks while it waits. Destruction waits for the queued call
+template <typename T, typename Executor = ThreadPool>
+class SetterTypeAsync {
+public:
+    SetterTypeAsync() = default;
+
+    template <typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, SetterTypeAsync>>>
+    SetterTypeAsync(F&& apply, Executor& executor = ThreadPool::Default())
+        : m_State(std::make_shared<State>(std::forward<F>(apply), executor))
+    {
+    }
+
+    // Copy takes the function and the executor, queued call stays with the original
+    SetterTypeAsync(const SetterTypeAsync& other)
+        : m_State(other.m_State ? std::make_shared<State>(other.m_State->m_Apply, *other.m_State->m_Executor) : nullptr)
+    {
+    }
+
+    SetterTypeAsync(SetterTypeAsync&& other) noexcept = default;
+
+    SetterTypeAsync& operator=(SetterTypeAsync other) {
+        Wait();
+        m_State = std::move(other.m_State);
+        return *this;
+    }
+
+    ~SetterTypeAsync() { Wait(); }
+
+    explicit operator bool() const { return m_State && m_State->m_Apply; }
+
+    // Replaces the pending value, the setter is submitted only if it isn't queued yet
+    void Post(const T& value) const {
+        std::lock_guard<std::mutex> lock(m_State->m_Mutex);
+        m_State->m_Pending = value;
+        if (!m_State->m_Scheduled) {
+            m_State->m_Scheduled = true;
+            // Submitted under the lock, so Flush() finds the task queued whenever it's scheduled
+            m_State->m_Executor->Submit([state = m_State]() { Run(*state); });
+        }
+    }
+
+    // True while a setter call is queued or running
+    bool Pending() const {
+        if (!m_State) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(m_State->m_Mutex);
+        return m_State->m_Scheduled;
+    }
+
+    void Flush() const {
+        Wait();
+        if (!m_State) {
+            return;
+        }
+        std::exception_ptr error;
+        {
+            std::lock_guard<std::mutex> lock(m_State->m_Mutex);
+            error = std::exchange(m_State->m_Error, nullptr);
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+private:
+    struct State {
+        State(std::function<void(const T&)> apply, Executor& executor)
+            : m_Apply(std::move(apply)), m_Executor(&executor) {}
+
+        std::function<void(const T&)> m_Apply;
+        Executor* m_Executor;
+        std::mutex m_Mutex;
+        std::condition_variable m_Done;
+        std::optional<T> m_Pending;
+        bool m_Scheduled = false;
+        std::exception_ptr m_Error;
+    };
+
+    // Runs the setter until no value is pending. State is owned by the task, so it outlives the property
+    static void Run(State& state) {
+        std::unique_lock<std::mutex> lock(state.m_Mutex);
+        while (state.m_Pending) {
+            T value = std::move(*state.m_Pending);
+            state.m_Pending.reset();
+            lock.unlock();
+            try {
+                state.m_Apply(value);
+            } catch (...) {
+                lock.lock();
+                if (!state.m_Error) {
+                    state.m_Error = std::current_exception();
+                }
+                lock.unlock();
+            }
+            lock.lock();
+        }
+        state.m_Scheduled = false;
+        state.m_Done.notify_all();
+    }
+
+    void Wait() const {
+        if (!m_State) {
+            return;
+        }
+        std::unique_lock<std::mutex> lock(m_State->m_Mutex);
+        while (m_State->m_Scheduled) {
+            if constexpr (detail::HasRunPending<Executor>::value) {
+                lock.unlock();
+                const bool ran = m_State->m_Executor->RunPending();
+                lock.lock();
+                if (ran) {
+                    continue;
+                }
+            }
+            // Queue is empty, so the task is running on another thread
+            m_State->m_Done.wait(lock, [this]() { return !m_State->m_Scheduled; });
+        }
+    }
+
+    std::shared_ptr<State> m_State;
+};
+
+namespace detail {
+
+template <typename T, typename Executor>
+inline constexpr bool IsAsyncSetter<SetterTypeAsync<T, Executor>> = true;
+
+template <typename T, typename Executor>
+struct IsSetterType<SetterTypeAsync<T, Executor>, T> : std::true_type {};
+
+} // namespace detail
+
+// Read-write property, single-threaded, setter runs asynchronously on ThreadPool::Default()
+template <typename T>
+using PropertyAsync = Property<T, false, false, NoGetter, SetterTypeAsync<T>>;
+
+// Read-write property, multi-threaded, setter runs asynchronously without holding the property lock
+template <typename T>
+using PropertyAsyncMT = Property<T, false, true, NoGetter, SetterTypeAsync<T>>;
+
+} // namespace propp
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "propp/Observer.hpp"
+
+#include <atomic>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace propp {
+
+// Memoizing getter `T()`, result is cached in the property storage and returned until
+// Invalidate() is called or one of dependencies declared with DependsOn() changes.
+// Getter must not read the property itself, such read returns previous result
+template <typename T>
+class GetterTypeCached {
+public:
+    GetterTypeCached() = default;
+
+    template <typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, GetterTypeCached>>>
+    GetterTypeCached(F&& compute) : m_Compute(std::forward<F>(compute)) {}
+
+    // Copy takes the function only, cache of the copy starts stale and has no dependencies
+    GetterTypeCached(const GetterTypeCached& other) : m_Compute(other.m_Compute) {}
+    GetterTypeCached& operator=(const GetterTypeCached& other) {
+        m_Compute = other.m_Compute;
+        Invalidate();
+        return *this;
+    }
+
+    explicit operator bool() const { return static_cast<bool>(m_Compute); }
+    T operator()() const { return m_Compute(); }
+
+    void Invalidate() const { m_Valid.store(false, std::memory_order_release); }
+
+    // Marks cache valid, returns true if it was stale and has to be recomputed
+    bool Validate() const { return !m_Valid.exchange(true, std::memory_order_acq_rel); }
+
+    // Subscription is released with the getter
+    template <typename Dependency>
+    void AddDependency(Dependency& dependency) {
+        const GetterTypeCached* getter = this;
+        m_Dependencies.push_back(dependency.Subscribe([getter](const auto&) { getter->Invalidate(); }));
+    }
+
+private:
+    std::function<T()> m_Compute;
+    mutable std::atomic<bool> m_Valid{false};
+    std::vector<Subscription> m_Dependencies;
+};
+
+namespace detail {
+
+template <typename T>
+inline constexpr bool IsCachedGetter<GetterTypeCached<T>> = true;
+
+template <typename T>
+struct IsGetterType<GetterTypeCached<T>, T> : std::true_type {};
+
+} // namespace detail
+
+// Read-only computed property, single-threaded, getter result is cached and returned by const reference
+template <typename T>
+using PropertyCached = Property<T, true, false, GetterTypeCached<T>, NoSetter>;
+
+// Read-only computed property, multi-threaded, getter result is cached and returned by value copied under the lock
+template <typename T>
+using PropertyCachedMT = Property<T, true, true, GetterTypeCached<T>, NoSetter>;
+
+} // namespace propp
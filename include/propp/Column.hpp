@@ -0,0 +1,688 @@
+#pragma once
+
+#include "propp/Property.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Bulk column loops are element-wise and operands are copied out of the column, so the compiler may
+// vectorize them without alias checks. There are no hand-written SIMD kernels, the pragmas only ask for
+// compiler auto-vectorization and the width of generated code follows target flags, e.g. -mavx2.
+// PROPP_OPENMP_SIMD=1 together with -fopenmp-simd (CMake option PROPP_OPENMP_SIMD) marks the loops
+// `omp simd`, which requests vectorization regardless of the optimizer's cost model
+#ifndef PROPP_OPENMP_SIMD
+#define PROPP_OPENMP_SIMD 0
+#endif
+
+#define PROPP_PRAGMA(text) _Pragma(#text)
+
+#if PROPP_OPENMP_SIMD && (defined(__clang__) || defined(__GNUC__))
+#define PROPP_VECTORIZE _Pragma("omp simd")
+#define PROPP_VECTORIZE_SUM(sum) PROPP_PRAGMA(omp simd reduction(+ : sum))
+#elif defined(__clang__)
+#define PROPP_VECTORIZE _Pragma("clang loop vectorize(enable) interleave(enable)")
+#define PROPP_VECTORIZE_SUM(sum) PROPP_VECTORIZE
+#elif defined(__GNUC__)
+// ivdep drops the alias checks but doesn't request vectorization, that takes -O3 or -ftree-vectorize.
+// GCC unroll is left out, it keeps GCC from vectorizing these loops
+#define PROPP_VECTORIZE _Pragma("GCC ivdep")
+#define PROPP_VECTORIZE_SUM(sum) PROPP_VECTORIZE
+#elif defined(_MSC_VER)
+#define PROPP_VECTORIZE __pragma(loop(ivdep))
+#define PROPP_VECTORIZE_SUM(sum) PROPP_VECTORIZE
+#else
+#define PROPP_VECTORIZE
+#define PROPP_VECTORIZE_SUM(sum)
+#endif
+
+namespace propp {
+
+// Result of bulk comparison, one byte per row of the column
+class ColumnMask {
+public:
+    ColumnMask() = default;
+    explicit ColumnMask(std::size_t size, bool value = false) : m_Bits(size, value ? 1 : 0) {}
+
+    std::size_t Size() const { return m_Bits.size(); }
+    bool operator[](std::size_t row) const { return m_Bits[row] != 0; }
+    void Set(std::size_t row, bool value) { m_Bits[row] = value ? 1 : 0; }
+
+    // Number of selected rows
+    std::size_t Count() const {
+        std::size_t count = 0;
+        PROPP_VECTORIZE_SUM(count)
+        for (std::size_t i = 0; i < m_Bits.size(); ++i) {
+            count += m_Bits[i];
+        }
+        return count;
+    }
+
+    ColumnMask& operator&=(const ColumnMask& other) { return Combine(other, [](std::uint8_t a, std::uint8_t b) { return std::uint8_t(a & b); }); }
+    ColumnMask& operator|=(const ColumnMask& other) { return Combine(other, [](std::uint8_t a, std::uint8_t b) { return std::uint8_t(a | b); }); }
+    ColumnMask& operator^=(const ColumnMask& other) { return Combine(other, [](std::uint8_t a, std::uint8_t b) { return std::uint8_t(a ^ b); }); }
+
+    ColumnMask operator&(const ColumnMask& other) const { ColumnMask result(*this); return result &= other; }
+    ColumnMask operator|(const ColumnMask& other) const { ColumnMask result(*this); return result |= other; }
+    ColumnMask operator^(const ColumnMask& other) const { ColumnMask result(*this); return result ^= other; }
+
+    ColumnMask operator~() const {
+        ColumnMask result(*this);
+        PROPP_VECTORIZE
+        for (std::size_t i = 0; i < result.m_Bits.size(); ++i) {
+            result.m_Bits[i] ^= 1;
+        }
+        return result;
+    }
+
+    std::uint8_t* Data() { return m_Bits.data(); }
+    const std::uint8_t* Data() const { return m_Bits.data(); }
+
+private:
+    // Masks of different sizes are combined over the shorter one, missing rows are not selected
+    template <typename Operation>
+    ColumnMask& Combine(const ColumnMask& other, Operation operation) {
+        const std::size_t common = std::min(m_Bits.size(), other.m_Bits.size());
+        std::uint8_t* bits = m_Bits.data();
+        const std::uint8_t* otherBits = other.m_Bits.data();
+        PROPP_VECTORIZE
+        for (std::size_t i = 0; i < common; ++i) {
+            bits[i] = operation(bits[i], otherBits[i]);
+        }
+        std::fill(m_Bits.begin() + common, m_Bits.end(), std::uint8_t(0));
+        return *this;
+    }
+
+    std::vector<std::uint8_t> m_Bits;
+};
+
+// Rows of a column, optionally filtered by mask, with bulk forms of the property operators.
+// Compound operators modify every selected row under one lock, comparisons return ColumnMask of the column size
+template <typename Column>
+class ColumnRange {
+public:
+    using T = typename Column::ValueType;
+
+    ColumnRange(Column& column, std::size_t first, std::size_t count, const ColumnMask* mask = nullptr)
+        : m_Column(column), m_First(first), m_Count(count), m_Mask(mask) {}
+
+    // Arithmetic operators
+    template <typename F>
+    ColumnRange& operator+=(const F& value) { const T rhs = static_cast<T>(value); return Update([rhs](T& v) { v += rhs; }); }
+    template <typename F>
+    ColumnRange& operator-=(const F& value) { const T rhs = static_cast<T>(value); return Update([rhs](T& v) { v -= rhs; }); }
+    template <typename F>
+    ColumnRange& operator*=(const F& value) { const T rhs = static_cast<T>(value); return Update([rhs](T& v) { v *= rhs; }); }
+    template <typename F>
+    ColumnRange& operator/=(const F& value) { const T rhs = static_cast<T>(value); return Update([rhs](T& v) { v /= rhs; }); }
+    template <typename F>
+    ColumnRange& operator%=(const F& value) { const T rhs = static_cast<T>(value); return Update([rhs](T& v) { v %= rhs; }); }
+
+    // Bitwise operators
+    template <typename F>
+    ColumnRange& operator&=(const F& value) { const T rhs = static_cast<T>(value); return Update([rhs](T& v) { v &= rhs; }); }
+    template <typename F>
+    ColumnRange& operator|=(const F& value) { const T rhs = static_cast<T>(value); return Update([rhs](T& v) { v |= rhs; }); }
+    template <typename F>
+    ColumnRange& operator^=(const F& value) { const T rhs = static_cast<T>(value); return Update([rhs](T& v) { v ^= rhs; }); }
+    template <typename F>
+    ColumnRange& operator<<=(const F& value) { const T rhs = static_cast<T>(value); return Update([rhs](T& v) { v <<= rhs; }); }
+    template <typename F>
+    ColumnRange& operator>>=(const F& value) { const T rhs = static_cast<T>(value); return Update([rhs](T& v) { v >>= rhs; }); }
+
+    // Assigns the value to every selected row
+    template <typename F>
+    ColumnRange& Fill(const F& value) { const T rhs = static_cast<T>(value); return Update([&rhs](T& v) { v = rhs; }); }
+
+    // Comparison operators
+    template <typename F>
+    ColumnMask operator==(const F& value) const { const T rhs = static_cast<T>(value); return Compare([&rhs](const T& v) { return v == rhs; }); }
+    template <typename F>
+    ColumnMask operator!=(const F& value) const { const T rhs = static_cast<T>(value); return Compare([&rhs](const T& v) { return v != rhs; }); }
+    template <typename F>
+    ColumnMask operator<(const F& value) const { const T rhs = static_cast<T>(value); return Compare([&rhs](const T& v) { return v < rhs; }); }
+    template <typename F>
+    ColumnMask operator<=(const F& value) const { const T rhs = static_cast<T>(value); return Compare([&rhs](const T& v) { return v <= rhs; }); }
+    template <typename F>
+    ColumnMask operator>(const F& value) const { const T rhs = static_cast<T>(value); return Compare([&rhs](const T& v) { return v > rhs; }); }
+    template <typename F>
+    ColumnMask operator>=(const F& value) const { const T rhs = static_cast<T>(value); return Compare([&rhs](const T& v) { return v >= rhs; }); }
+
+    // Applies `operation(T&)` to every selected row
+    template <typename Operation>
+    ColumnRange& Update(Operation&& operation) {
+        static_assert(!std::is_const_v<Column>, "Rows of const column are read-only");
+        m_Column.ApplyRange(m_First, m_Count, m_Mask, std::forward<Operation>(operation));
+        return *this;
+    }
+
+    // Selects rows where `predicate(const T&)` returns true
+    template <typename Predicate>
+    ColumnMask Compare(Predicate&& predicate) const {
+        return m_Column.CompareRange(m_First, m_Count, m_Mask, std::forward<Predicate>(predicate));
+    }
+
+    std::size_t First() const { return m_First; }
+    std::size_t Count() const { return m_Count; }
+
+private:
+    Column& m_Column;
+    std::size_t m_First;
+    std::size_t m_Count;
+    const ColumnMask* m_Mask;
+};
+
+namespace detail {
+
+// Operators of property-like proxies. Derived provides `Read(reader)` and `ApplyOperation(operation)`
+// with the same meaning as in Property
+template <typename Derived, typename T>
+class ValueOperators {
+public:
+    // Arithmetic operators
+    template <typename F>
+    Derived& operator+=(const F& value) { auto&& rhs = AsOperand<T>(value); return Self().ApplyOperation([&rhs](T& v) { v += rhs; }); }
+    template <typename F>
+    Derived& operator-=(const F& value) { auto&& rhs = AsOperand<T>(value); return Self().ApplyOperation([&rhs](T& v) { v -= rhs; }); }
+    template <typename F>
+    Derived& operator*=(const F& value) { auto&& rhs = AsOperand<T>(value); return Self().ApplyOperation([&rhs](T& v) { v *= rhs; }); }
+    template <typename F>
+    Derived& operator/=(const F& value) { auto&& rhs = AsOperand<T>(value); return Self().ApplyOperation([&rhs](T& v) { v /= rhs; }); }
+    template <typename F>
+    Derived& operator%=(const F& value) { auto&& rhs = AsOperand<T>(value); return Self().ApplyOperation([&rhs](T& v) { v %= rhs; }); }
+
+    // Bitwise operators
+    template <typename F>
+    Derived& operator&=(const F& value) { auto&& rhs = AsOperand<T>(value); return Self().ApplyOperation([&rhs](T& v) { v &= rhs; }); }
+    template <typename F>
+    Derived& operator|=(const F& value) { auto&& rhs = AsOperand<T>(value); return Self().ApplyOperation([&rhs](T& v) { v |= rhs; }); }
+    template <typename F>
+    Derived& operator^=(const F& value) { auto&& rhs = AsOperand<T>(value); return Self().ApplyOperation([&rhs](T& v) { v ^= rhs; }); }
+    template <typename F>
+    Derived& operator<<=(const F& value) { auto&& rhs = AsOperand<T>(value); return Self().ApplyOperation([&rhs](T& v) { v <<= rhs; }); }
+    template <typename F>
+    Derived& operator>>=(const F& value) { auto&& rhs = AsOperand<T>(value); return Self().ApplyOperation([&rhs](T& v) { v >>= rhs; }); }
+
+    // Increment and decrement
+    Derived& operator++() { return Self().ApplyOperation([](T& v) { ++v; }); }
+    Derived& operator--() { return Self().ApplyOperation([](T& v) { --v; }); }
+    Derived& operator++(int) { return ++(*this); }
+    Derived& operator--(int) { return --(*this); }
+
+    // Arithmetic operator overloads (binary operators)
+    template <typename F>
+    auto operator+(const F& value) const { auto&& rhs = AsOperand<T>(value); return Self().Read([&rhs](const T& v) { return v + rhs; }); }
+    template <typename F>
+    auto operator-(const F& value) const { auto&& rhs = AsOperand<T>(value); return Self().Read([&rhs](const T& v) { return v - rhs; }); }
+    template <typename F>
+    auto operator*(const F& value) const { auto&& rhs = AsOperand<T>(value); return Self().Read([&rhs](const T& v) { return v * rhs; }); }
+    template <typename F>
+    auto operator/(const F& value) const { auto&& rhs = AsOperand<T>(value); return Self().Read([&rhs](const T& v) { return v / rhs; }); }
+    template <typename F>
+    auto operator%(const F& value) const { auto&& rhs = AsOperand<T>(value); return Self().Read([&rhs](const T& v) { return v % rhs; }); }
+
+    // Bitwise operator overloads (binary operators)
+    template <typename F>
+    auto operator&(const F& value) const { auto&& rhs = AsOperand<T>(value); return Self().Read([&rhs](const T& v) { return v & rhs; }); }
+    template <typename F>
+    auto operator|(const F& value) const { auto&& rhs = AsOperand<T>(value); return Self().Read([&rhs](const T& v) { return v | rhs; }); }
+    template <typename F>
+    auto operator^(const F& value) const { auto&& rhs = AsOperand<T>(value); return Self().Read([&rhs](const T& v) { return v ^ rhs; }); }
+    template <typename F>
+    auto operator<<(const F& value) const { auto&& rhs = AsOperand<T>(value); return Self().Read([&rhs](const T& v) { return v << rhs; }); }
+    template <typename F>
+    auto operator>>(const F& value) const { auto&& rhs = AsOperand<T>(value); return Self().Read([&rhs](const T& v) { return v >> rhs; }); }
+
+    // Comparison operators
+    template <typename F>
+    bool operator==(const F& value) const { auto&& rhs = AsOperand<T>(value); return Self().Read([&rhs](const T& v) { return v == rhs; }); }
+    template <typename F>
+    bool operator!=(const F& value) const { auto&& rhs = AsOperand<T>(value); return Self().Read([&rhs](const T& v) { return v != rhs; }); }
+    template <typename F>
+    bool operator<(const F& value) const { auto&& rhs = AsOperand<T>(value); return Self().Read([&rhs](const T& v) { return v < rhs; }); }
+    template <typename F>
+    bool operator<=(const F& value) const { auto&& rhs = AsOperand<T>(value); return Self().Read([&rhs](const T& v) { return v <= rhs; }); }
+    template <typename F>
+    bool operator>(const F& value) const { auto&& rhs = AsOperand<T>(value); return Self().Read([&rhs](const T& v) { return v > rhs; }); }
+    template <typename F>
+    bool operator>=(const F& value) const { auto&& rhs = AsOperand<T>(value); return Self().Read([&rhs](const T& v) { return v >= rhs; }); }
+
+private:
+    Derived& Self() { return static_cast<Derived&>(*this); }
+    const Derived& Self() const { return static_cast<const Derived&>(*this); }
+};
+
+// Applies `operation` to 64-byte blocks with constant trip count, which compilers vectorize even with
+// the cheap cost model of -O2, then to the remaining tail
+template <typename T, typename Operation>
+inline void ForEachBlocked(T* values, std::size_t count, Operation& operation) {
+    constexpr std::size_t BlockSize = sizeof(T) < 64 ? 64 / sizeof(T) : 1;
+    const std::size_t blocked = count - count % BlockSize;
+    for (std::size_t i = 0; i < blocked; i += BlockSize) {
+        T* block = values + i;
+        PROPP_VECTORIZE
+        for (std::size_t j = 0; j < BlockSize; ++j) {
+            operation(block[j]);
+        }
+    }
+    for (std::size_t i = blocked; i < count; ++i) {
+        operation(values[i]);
+    }
+}
+
+template <typename G>
+inline constexpr bool IsColumnGetter = std::is_same_v<G, NoGetter> || IsFunctorGetter<G>;
+
+template <typename S>
+inline constexpr bool IsColumnSetter = std::is_same_v<S, NoSetter> || IsFunctorSetter<S>;
+
+// Storage that records modified rows, e.g. journaled MappedVector in MappedStore.hpp
+template <typename Storage, typename = void>
+struct HasWrittenHook : std::false_type {};
+
+template <typename Storage>
+struct HasWrittenHook<Storage, std::void_t<decltype(std::declval<Storage&>().Written(std::size_t(), std::size_t()))>> : std::true_type {};
+
+template <typename Storage>
+inline void OnRowsWritten(Storage& storage, std::size_t first, std::size_t count) {
+    if constexpr (HasWrittenHook<Storage>::value) {
+        storage.Written(first, count);
+    }
+}
+
+} // namespace detail
+
+// Values of one property of many objects kept contiguous (structure of arrays). Rows are accessed with
+// lightweight handles that behave like Property. Getter and setter apply to every row, so only stateless
+// GetterTypeFunctor and SetterTypeFunctor are supported. Multi-threaded column has one lock for all rows.
+// Storage is std::vector<T> or a container with the same interface, e.g. MappedVector (MappedStore.hpp)
+template <typename T,
+    typename GetterType = NoGetter,
+    typename SetterType = NoSetter,
+    typename LockPolicy = NoLock,
+    typename StorageType = std::vector<T>
+>
+class PropertyColumn {
+public:
+    using Getter = GetterType;
+    using Setter = SetterType;
+    using Lock = LockPolicy;
+    using Storage = StorageType;
+    using Mutex = typename LockPolicy::Mutex;
+    using ValueType = T;
+
+    using Reference = typename detail::GetterResult<GetterType, T>::type;
+    static constexpr bool ReturnsValue = !std::is_reference_v<Reference>;
+    using ConstReference = std::conditional_t<ReturnsValue, const Reference, const std::remove_reference_t<Reference>&>;
+    using ReadLock = typename LockPolicy::ReadLock;
+    // Padded policy is checked by the policy it wraps
+    using BaseLock = typename detail::LockTraits<LockPolicy>::Base;
+
+    static_assert(detail::IsColumnGetter<GetterType>, "Column getter must be GetterTypeFunctor or NoGetter");
+    static_assert(detail::IsColumnSetter<SetterType>, "Column setter must be SetterTypeFunctor or NoSetter");
+    static_assert(
+        !std::is_same_v<BaseLock, LockFree> && !std::is_same_v<BaseLock, SeqLock> && !std::is_same_v<BaseLock, Snapshot> &&
+        detail::BufferSlots<BaseLock> == 0,
+        "Column storage supports NoLock, RecursiveLock and SharedLock"
+    );
+    static_assert(!std::is_same_v<T, bool>, "std::vector<bool> is not contiguous, use std::uint8_t column");
+
+    // Handle of one row, valid until the column is resized. Assigning one handle to another copies the value
+    template <bool ReadOnly>
+    class RowHandle : public detail::ValueOperators<RowHandle<ReadOnly>, T> {
+    public:
+        using detail::ValueOperators<RowHandle<ReadOnly>, T>::operator*;
+        using Column = std::conditional_t<ReadOnly, const PropertyColumn, PropertyColumn>;
+
+        RowHandle(Column& column, std::size_t row) : m_Column(&column), m_Row(row) {}
+        RowHandle(const RowHandle&) = default;
+
+        template <typename F, bool RO = ReadOnly, typename std::enable_if<!RO && !std::is_same_v<std::decay_t<F>, RowHandle>, int>::type = 0>
+        RowHandle& operator=(F&& value) {
+            if constexpr (std::is_same_v<std::decay_t<F>, T>) {
+                m_Column->Set(m_Row, std::forward<F>(value));
+            } else {
+                m_Column->Set(m_Row, static_cast<T>(std::forward<F>(value)));
+            }
+            return *this;
+        }
+
+        RowHandle& operator=(const RowHandle& other) {
+            static_assert(!ReadOnly, "Row of const column is read-only");
+            m_Column->Set(m_Row, other.Read([](const T& v) { return v; }));
+            return *this;
+        }
+
+        // Type conversion operators
+        operator T() const { return Read([](const T& v) { return v; }); }
+
+        decltype(auto) operator*() const { return m_Column->Get(m_Row); }
+        decltype(auto) operator()() const { return m_Column->Get(m_Row); }
+        decltype(auto) GetRaw() const { return m_Column->GetRaw(m_Row); }
+
+        std::size_t Row() const { return m_Row; }
+
+        template <typename Reader>
+        auto Read(Reader&& reader) const { return m_Column->Read(m_Row, std::forward<Reader>(reader)); }
+
+        template <typename Operation>
+        RowHandle& ApplyOperation(Operation&& operation) {
+            static_assert(!ReadOnly, "Row of const column is read-only");
+            m_Column->Apply(m_Row, std::forward<Operation>(operation));
+            return *this;
+        }
+
+        template <typename Operation>
+        RowHandle& Update(Operation&& operation) { return ApplyOperation(std::forward<Operation>(operation)); }
+
+    private:
+        Column* m_Column;
+        std::size_t m_Row;
+    };
+
+    using Handle = RowHandle<false>;
+    using ConstHandle = RowHandle<true>;
+
+    PropertyColumn() = default;
+    explicit PropertyColumn(std::size_t size, const T& value = T()) : m_Values(size, value) {}
+    explicit PropertyColumn(Storage storage) : m_Values(std::move(storage)) {}
+
+    PropertyColumn(const PropertyColumn&) = delete;
+    PropertyColumn& operator=(const PropertyColumn&) = delete;
+
+    Handle operator[](std::size_t row) { return Handle(*this, row); }
+    ConstHandle operator[](std::size_t row) const { return ConstHandle(*this, row); }
+
+    // Appends a row, the value goes through the setter. Returns index of the row
+    template <typename U = T>
+    std::size_t PushBack(U&& value) {
+        std::lock_guard<Mutex> lock(m_Mutex.Get());
+        if constexpr (std::is_same_v<SetterType, NoSetter>) {
+            m_Values.push_back(std::forward<U>(value));
+        } else {
+            m_Values.push_back(m_Setter(static_cast<const T&>(value)));
+        }
+        return m_Values.size() - 1;
+    }
+
+    template <typename... Args>
+    std::size_t EmplaceBack(Args&&... args) {
+        if constexpr (std::is_same_v<SetterType, NoSetter>) {
+            std::lock_guard<Mutex> lock(m_Mutex.Get());
+            m_Values.emplace_back(std::forward<Args>(args)...);
+            return m_Values.size() - 1;
+        } else {
+            return PushBack(T(std::forward<Args>(args)...));
+        }
+    }
+
+    // Removes the row by moving the last row into its place, handles of the last row become invalid
+    void SwapRemove(std::size_t row) {
+        std::lock_guard<Mutex> lock(m_Mutex.Get());
+        if (row + 1 != m_Values.size()) {
+            m_Values[row] = std::move(m_Values.back());
+            detail::OnRowsWritten(m_Values, row, 1);
+        }
+        m_Values.pop_back();
+    }
+
+    void Resize(std::size_t size) {
+        std::lock_guard<Mutex> lock(m_Mutex.Get());
+        m_Values.resize(size);
+    }
+
+    void Reserve(std::size_t capacity) {
+        std::lock_guard<Mutex> lock(m_Mutex.Get());
+        m_Values.reserve(capacity);
+    }
+
+    void Clear() {
+        std::lock_guard<Mutex> lock(m_Mutex.Get());
+        m_Values.clear();
+    }
+
+    std::size_t Size() const {
+        ReadLock lock(m_Mutex.Get());
+        return m_Values.size();
+    }
+
+    bool Empty() const { return Size() == 0; }
+
+    // Value of the row through the getter
+    Reference Get(std::size_t row) {
+        ReadLock lock(m_Mutex.Get());
+        return GetST(row);
+    }
+
+    ConstReference Get(std::size_t row) const {
+        ReadLock lock(m_Mutex.Get());
+        return GetST(row);
+    }
+
+    // Raw value of the row, bypasses the getter
+    T& GetRaw(std::size_t row) {
+        ReadLock lock(m_Mutex.Get());
+        return m_Values[row];
+    }
+
+    const T& GetRaw(std::size_t row) const {
+        ReadLock lock(m_Mutex.Get());
+        return m_Values[row];
+    }
+
+    // Assigns the row through the setter
+    template <typename U>
+    void Set(std::size_t row, U&& value) {
+        std::lock_guard<Mutex> lock(m_Mutex.Get());
+        SetST(row, std::forward<U>(value));
+    }
+
+    template <typename Reader>
+    auto Read(std::size_t row, Reader&& reader) const {
+        ReadLock lock(m_Mutex.Get());
+        return reader(GetST(row));
+    }
+
+    // Read-modify-write of the row, in place when the column has no getter and setter
+    template <typename Operation>
+    void Apply(std::size_t row, Operation&& operation) {
+        std::lock_guard<Mutex> lock(m_Mutex.Get());
+        ApplyST(row, std::forward<Operation>(operation));
+    }
+
+    // Bulk operations, e.g. `Scores.All() *= 0.99f` or `Health.Where(Health.All() < 10) += 5`.
+    // Ranges are valid until the column is resized, masked range keeps a pointer to the mask
+    ColumnRange<PropertyColumn> All() { return ColumnRange<PropertyColumn>(*this, 0, Size()); }
+    ColumnRange<const PropertyColumn> All() const { return ColumnRange<const PropertyColumn>(*this, 0, Size()); }
+
+    ColumnRange<PropertyColumn> Range(std::size_t first, std::size_t count) {
+        assert(first <= Size() && count <= Size() - first && "range is outside the column");
+        return ColumnRange<PropertyColumn>(*this, first, count);
+    }
+    ColumnRange<const PropertyColumn> Range(std::size_t first, std::size_t count) const {
+        assert(first <= Size() && count <= Size() - first && "range is outside the column");
+        return ColumnRange<const PropertyColumn>(*this, first, count);
+    }
+
+    ColumnRange<PropertyColumn> Where(const ColumnMask& mask) {
+        return ColumnRange<PropertyColumn>(*this, 0, std::min(mask.Size(), Size()), &mask);
+    }
+    ColumnRange<const PropertyColumn> Where(const ColumnMask& mask) const {
+        return ColumnRange<const PropertyColumn>(*this, 0, std::min(mask.Size(), Size()), &mask);
+    }
+
+    // Contiguous raw values, bypass getter, setter and the lock. Pointer is valid until the column is resized.
+    // Writes through the pointer aren't journaled by MappedVector
+    T* Data() { return m_Values.data(); }
+    const T* Data() const { return m_Values.data(); }
+
+private:
+    friend struct detail::PropertyAccess;
+    template <typename Column>
+    friend class ColumnRange;
+
+    // Without getter and setter selected rows are modified in place by a vectorizable loop,
+    // otherwise every row goes through ApplyST and the setter
+    template <typename Operation>
+    void ApplyRange(std::size_t first, std::size_t count, const ColumnMask* mask, Operation&& operation) {
+        std::lock_guard<Mutex> lock(m_Mutex.Get());
+        // Column may have been resized since the range was taken
+        assert(first <= m_Values.size() && count <= m_Values.size() - first && "range is outside the column");
+        if constexpr (std::is_same_v<GetterType, NoGetter> && std::is_same_v<SetterType, NoSetter>) {
+            T* values = m_Values.data() + first;
+            if (mask) {
+                const std::uint8_t* selected = mask->Data() + first;
+                PROPP_VECTORIZE
+                for (std::size_t i = 0; i < count; ++i) {
+                    if (selected[i]) {
+                        operation(values[i]);
+                    }
+                }
+            } else {
+                detail::ForEachBlocked(values, count, operation);
+            }
+            detail::OnRowsWritten(m_Values, first, count);
+        } else {
+            for (std::size_t i = first; i < first + count; ++i) {
+                if (!mask || (*mask)[i]) {
+                    ApplyST(i, operation);
+                }
+            }
+        }
+    }
+
+    template <typename Predicate>
+    ColumnMask CompareRange(std::size_t first, std::size_t count, const ColumnMask* mask, Predicate&& predicate) const {
+        ReadLock lock(m_Mutex.Get());
+        assert(first <= m_Values.size() && count <= m_Values.size() - first && "range is outside the column");
+        ColumnMask result(m_Values.size());
+        std::uint8_t* out = result.Data() + first;
+        if constexpr (std::is_same_v<GetterType, NoGetter>) {
+            const T* values = m_Values.data() + first;
+            PROPP_VECTORIZE
+            for (std::size_t i = 0; i < count; ++i) {
+                out[i] = predicate(values[i]) ? 1 : 0;
+            }
+        } else {
+            for (std::size_t i = 0; i < count; ++i) {
+                out[i] = predicate(GetST(first + i)) ? 1 : 0;
+            }
+        }
+        if (mask) {
+            const std::uint8_t* selected = mask->Data() + first;
+            PROPP_VECTORIZE
+            for (std::size_t i = 0; i < count; ++i) {
+                out[i] &= selected[i];
+            }
+        }
+        return result;
+    }
+
+    // Same as the public accessors, caller holds the lock
+    inline ConstReference GetST(std::size_t row) const {
+        if constexpr (std::is_same_v<GetterType, NoGetter>) {
+            return m_Values[row];
+        } else {
+            return m_Getter(m_Values[row]);
+        }
+    }
+
+    inline Reference GetST(std::size_t row) {
+        if constexpr (std::is_same_v<GetterType, NoGetter>) {
+            return m_Values[row];
+        } else {
+            return m_Getter(m_Values[row]);
+        }
+    }
+
+    template <typename U>
+    inline void SetST(std::size_t row, U&& value) {
+        if constexpr (std::is_same_v<SetterType, NoSetter>) {
+            m_Values[row] = std::forward<U>(value);
+        } else {
+            m_Values[row] = m_Setter(static_cast<const T&>(value));
+        }
+        detail::OnRowsWritten(m_Values, row, 1);
+    }
+
+    template <typename Operation>
+    inline void ApplyST(std::size_t row, Operation&& operation) {
+        if constexpr (std::is_same_v<GetterType, NoGetter> && std::is_same_v<SetterType, NoSetter>) {
+            operation(m_Values[row]);
+            detail::OnRowsWritten(m_Values, row, 1);
+        } else {
+            T value = GetST(row);
+            operation(value);
+            SetST(row, std::move(value));
+        }
+    }
+
+    Storage m_Values;
+    PROPP_NO_UNIQUE_ADDRESS detail::MutableSlot<Mutex> m_Mutex;
+
+    PROPP_NO_UNIQUE_ADDRESS Getter m_Getter;
+    PROPP_NO_UNIQUE_ADDRESS Setter m_Setter;
+};
+
+// Column, multi-threaded, one lock for all rows
+template <typename T, typename GetterType = NoGetter, typename SetterType = NoSetter>
+using PropertyColumnMT = PropertyColumn<T, GetterType, SetterType, RecursiveLock>;
+
+// Columns that share row indices, e.g. PropertyTable<PropertyColumn<int>, PropertyColumn<std::string>>.
+// Row(i) returns handles for structured bindings: `auto [age, name] = table.Row(i);`
+template <typename... Columns>
+class PropertyTable {
+public:
+    static_assert(sizeof...(Columns) > 0, "Table requires at least one column");
+
+    using Handles = std::tuple<typename Columns::Handle...>;
+    using ConstHandles = std::tuple<typename Columns::ConstHandle...>;
+
+    PropertyTable() = default;
+    PropertyTable(const PropertyTable&) = delete;
+    PropertyTable& operator=(const PropertyTable&) = delete;
+
+    template <std::size_t I>
+    auto& Column() { return std::get<I>(m_Columns); }
+    template <std::size_t I>
+    const auto& Column() const { return std::get<I>(m_Columns); }
+
+    // Appends a row with one value per column, returns index of the row
+    template <typename... Values>
+    std::size_t AddRow(Values&&... values) {
+        static_assert(sizeof...(Values) == sizeof...(Columns), "AddRow requires one value per column");
+        return AddRowImpl(std::index_sequence_for<Columns...>{}, std::forward<Values>(values)...);
+    }
+
+    Handles Row(std::size_t row) {
+        return std::apply([row](auto&... columns) { return Handles(columns[row]...); }, m_Columns);
+    }
+
+    ConstHandles Row(std::size_t row) const {
+        return std::apply([row](const auto&... columns) { return ConstHandles(columns[row]...); }, m_Columns);
+    }
+
+    void SwapRemove(std::size_t row) { std::apply([row](auto&... columns) { (columns.SwapRemove(row), ...); }, m_Columns); }
+    void Resize(std::size_t size) { std::apply([size](auto&... columns) { (columns.Resize(size), ...); }, m_Columns); }
+    void Reserve(std::size_t capacity) { std::apply([capacity](auto&... columns) { (columns.Reserve(capacity), ...); }, m_Columns); }
+    void Clear() { std::apply([](auto&... columns) { (columns.Clear(), ...); }, m_Columns); }
+
+    std::size_t Size() const { return std::get<0>(m_Columns).Size(); }
+
+private:
+    template <std::size_t... I, typename... Values>
+    std::size_t AddRowImpl(std::index_sequence<I...>, Values&&... values) {
+        std::size_t row = 0;
+        ((row = std::get<I>(m_Columns).PushBack(static_cast<typename Columns::ValueType>(std::forward<Values>(values)))), ...);
+        return row;
+    }
+
+    std::tuple<Columns...> m_Columns;
+};
+
+} // namespace propp
@@ -0,0 +1,178 @@
+#pragma once
+
+#include "propp/Observer.hpp"
+
+// Awaitable changes of observable properties. Requires C++20 coroutines, in C++17 the header declares nothing
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#include <atomic>
+#include <coroutine>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace propp {
+
+namespace detail {
+
+// Shared by the awaiter and its subscription. Coroutine is resumed once even if the subscription is
+// delivered again before the awaiter drops it. Change delivered before the awaiter is armed, e.g. by
+// LockFree writer, cancels the suspension instead
+template <typename T>
+struct AwaitState {
+    std::mutex m_Mutex;
+    std::coroutine_handle<> m_Handle;
+    std::optional<T> m_Value;
+    bool m_Armed = false;
+    bool m_Fired = false;
+};
+
+// Scheduler is either ChangeQueue, the coroutine is resumed by the thread calling Flush(), or executor
+// with Submit(std::function<void()>), e.g. ThreadPool, the coroutine is resumed by the executor.
+// Writer never resumes the coroutine itself
+template <typename P, typename Scheduler, typename Predicate>
+class ChangeAwaiter {
+public:
+    using T = typename P::ValueType;
+
+    ChangeAwaiter(P& property, Scheduler& scheduler, Predicate predicate, bool checkCurrent)
+        : m_Property(property)
+        , m_Scheduler(scheduler)
+        , m_Predicate(std::move(predicate))
+        , m_CheckCurrent(checkCurrent)
+        , m_State(std::make_shared<AwaitState<T>>())
+    {
+    }
+
+    ChangeAwaiter(const ChangeAwaiter&) = delete;
+    ChangeAwaiter& operator=(const ChangeAwaiter&) = delete;
+
+    // Drops pending resumption, e.g. when suspended coroutine is destroyed
+    ~ChangeAwaiter() {
+        {
+            std::lock_guard<std::mutex> lock(m_State->m_Mutex);
+            m_State->m_Fired = true;
+        }
+        m_Subscription.Reset();
+    }
+
+    // Current value is tested under the lock in await_suspend, so no write is missed in between
+    bool await_ready() const noexcept { return false; }
+
+    bool await_suspend(std::coroutine_handle<> handle) {
+        std::lock_guard<typename P::Mutex> lock(PropertyAccess::GetMutex(m_Property));
+        if (m_CheckCurrent && Test(PropertyAccess::ReadST(m_Property, Copy()))) {
+            return false;
+        }
+
+        m_State->m_Handle = handle;
+        std::shared_ptr<AwaitState<T>> state = m_State;
+        P* property = &m_Property;
+        const Predicate* predicate = &m_Predicate;
+        if constexpr (std::is_same_v<Scheduler, ChangeQueue>) {
+            // Delivered by Flush() without locks held, the value is read again
+            m_Subscription = PropertyAccess::GetHooks(m_Property).AddListener([state, property, predicate]() {
+                Fire(*state, *predicate, PropertyAccess::Read(*property, Copy()), [](std::coroutine_handle<> h) { h.resume(); });
+            }, &m_Scheduler);
+        } else {
+            // Delivered by the writer while the property lock is held
+            Scheduler* scheduler = &m_Scheduler;
+            m_Subscription = PropertyAccess::GetHooks(m_Property).AddListener([state, property, scheduler, predicate]() {
+                Fire(*state, *predicate, PropertyAccess::ReadST(*property, Copy()), [scheduler](std::coroutine_handle<> h) {
+                    scheduler->Submit([h]() { h.resume(); });
+                });
+            }, nullptr);
+        }
+
+        // Resumption can't start before the subscription is stored, it's held back until the awaiter is armed
+        std::lock_guard<std::mutex> stateLock(m_State->m_Mutex);
+        if (m_State->m_Fired) {
+            return false;
+        }
+        m_State->m_Armed = true;
+        return true;
+    }
+
+    // Value that satisfied the predicate, taken when the change was delivered
+    T await_resume() {
+        m_Subscription.Reset();
+        std::lock_guard<std::mutex> lock(m_State->m_Mutex);
+        return std::move(*m_State->m_Value);
+    }
+
+private:
+    // Snapshot property passes the value it points to
+    static auto Copy() {
+        return [](const T& value) { return value; };
+    }
+
+    bool Test(T value) {
+        if (!m_Predicate(std::as_const(value))) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(m_State->m_Mutex);
+        m_State->m_Value = std::move(value);
+        return true;
+    }
+
+    template <typename Resume>
+    static void Fire(AwaitState<T>& state, const Predicate& predicate, T value, Resume&& resume) {
+        if (!predicate(std::as_const(value))) {
+            return;
+        }
+        std::coroutine_handle<> handle;
+        {
+            std::lock_guard<std::mutex> lock(state.m_Mutex);
+            if (state.m_Fired) {
+                return;
+            }
+            state.m_Fired = true;
+            state.m_Value = std::move(value);
+            if (!state.m_Armed) {
+                return;
+            }
+            handle = state.m_Handle;
+        }
+        resume(handle);
+    }
+
+    P& m_Property;
+    Scheduler& m_Scheduler;
+    Predicate m_Predicate;
+    bool m_CheckCurrent;
+    std::shared_ptr<AwaitState<T>> m_State;
+    Subscription m_Subscription;
+};
+
+struct AnyChange {
+    template <typename T>
+    bool operator()(const T&) const { return true; }
+};
+
+} // namespace detail
+
+// Suspends until the next write of `property` and returns the new value.
+//
+//     int age = co_await propp::Changed(person.Age, queue);
+//
+// Property must have Observable hook policy. Coroutine waits forever if the property is destroyed first
+template <typename P, typename Scheduler>
+auto Changed(P& property, Scheduler& scheduler) {
+    static_assert(!std::is_same_v<typename P::Hooks, NoHooks>, "Changed requires Observable hook policy");
+    return detail::ChangeAwaiter<P, Scheduler, detail::AnyChange>(property, scheduler, detail::AnyChange{}, false);
+}
+
+// Suspends until `predicate(value)` holds and returns the value, doesn't suspend if it holds already.
+//
+//     co_await propp::When(connection.State, pool, [](State state) { return state == State::Ready; });
+template <typename P, typename Scheduler, typename Predicate>
+auto When(P& property, Scheduler& scheduler, Predicate predicate) {
+    static_assert(!std::is_same_v<typename P::Hooks, NoHooks>, "When requires Observable hook policy");
+    return detail::ChangeAwaiter<P, Scheduler, Predicate>(property, scheduler, std::move(predicate), true);
+}
+
+} // namespace propp
+
+#endif
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "propp/Property.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace propp {
+
+namespace detail {
+
+// Small per-thread number assigned on first use, threads are spread over shards round-robin
+inline std::size_t ThreadShard() {
+    static std::atomic<std::size_t> next{0};
+    thread_local const std::size_t shard = next.fetch_add(1, std::memory_order_relaxed);
+    return shard;
+}
+
+} // namespace detail
+
+// Write-heavy counter, e.g. requests served. Every thread adds to its own cache-line sized shard, so
+// increments from different threads don't contend. Reads sum all shards and aren't a snapshot: increments
+// made during the read may be partially counted. Assignment isn't atomic with concurrent increments
+template <typename T, std::size_t Shards = 16>
+class PropertyCounter {
+public:
+    using ValueType = T;
+
+    static_assert(detail::HasAtomicFetch<T>, "PropertyCounter requires integral type");
+    static_assert(Shards > 0, "PropertyCounter requires at least one shard");
+
+    PropertyCounter(T value = T()) { m_Shards[0].m_Value.store(value, std::memory_order_relaxed); }
+
+    PropertyCounter(const PropertyCounter&) = delete;
+    PropertyCounter& operator=(const PropertyCounter&) = delete;
+
+    // Type conversion operators
+    operator T() const { return Get(); }
+    T operator()() const { return Get(); }
+    T operator*() const { return Get(); }
+
+    T Get() const {
+        T sum = T();
+        for (const Shard& shard : m_Shards) {
+            sum += shard.m_Value.load(std::memory_order_relaxed);
+        }
+        return sum;
+    }
+
+    // Returns current value and resets the counter, e.g. for exporting per-interval rates.
+    // Concurrent increments are counted either by this call or by the next one
+    T Exchange(T value = T()) {
+        T sum = m_Shards[0].m_Value.exchange(value, std::memory_order_relaxed);
+        for (std::size_t i = 1; i < Shards; ++i) {
+            sum += m_Shards[i].m_Value.exchange(T(), std::memory_order_relaxed);
+        }
+        return sum;
+    }
+
+    PropertyCounter& operator=(T value) {
+        Exchange(value);
+        return *this;
+    }
+
+    // Arithmetic operators
+    template <typename F>
+    PropertyCounter& operator+=(const F& value) {
+        LocalShard().fetch_add(static_cast<T>(value), std::memory_order_relaxed);
+        return *this;
+    }
+    template <typename F>
+    PropertyCounter& operator-=(const F& value) {
+        LocalShard().fetch_sub(static_cast<T>(value), std::memory_order_relaxed);
+        return *this;
+    }
+
+    // Prefix increment and decrement
+    PropertyCounter& operator++() { return *this += 1; }
+    PropertyCounter& operator--() { return *this -= 1; }
+
+    // Postfix increment and decrement
+    PropertyCounter& operator++(int) { return ++(*this); }
+    PropertyCounter& operator--(int) { return --(*this); }
+
+    // Comparison operators
+    template <typename F>
+    bool operator==(const F& value) const { return Get() == static_cast<T>(value); }
+    template <typename F>
+    bool operator!=(const F& value) const { return Get() != static_cast<T>(value); }
+    template <typename F>
+    bool operator<(const F& value) const { return Get() < static_cast<T>(value); }
+    template <typename F>
+    bool operator<=(const F& value) const { return Get() <= static_cast<T>(value); }
+    template <typename F>
+    bool operator>(const F& value) const { return Get() > static_cast<T>(value); }
+    template <typename F>
+    bool operator>=(const F& value) const { return Get() >= static_cast<T>(value); }
+
+private:
+    struct alignas(detail::CacheLineSize) Shard {
+        std::atomic<T> m_Value{T()};
+    };
+
+    std::atomic<T>& LocalShard() { return m_Shards[detail::ThreadShard() % Shards].m_Value; }
+
+    Shard m_Shards[Shards];
+};
+
+} // namespace propp
@@ -0,0 +1,155 @@
+#pragma once
+
+#include "propp/Property.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <type_traits>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace propp {
+
+class DirtySet;
+
+namespace detail {
+
+inline unsigned CountTrailingZeros(std::uint64_t bits) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctzll(bits));
+#elif defined(_MSC_VER) && defined(_WIN64)
+    unsigned long index;
+    _BitScanForward64(&index, bits);
+    return static_cast<unsigned>(index);
+#else
+    unsigned index = 0;
+    while ((bits & 1) == 0) {
+        bits >>= 1;
+        ++index;
+    }
+    return index;
+#endif
+}
+
+} // namespace detail
+
+// Hook policy that marks the property in the owner's DirtySet on every write. Property is bound
+// with DirtySet::Track(), writes before that are not recorded
+class DirtyTracked {
+public:
+    inline void OnChanged();
+
+private:
+    friend class DirtySet;
+
+    DirtySet* m_Set = nullptr;
+    std::size_t m_Index = 0;
+};
+
+// One dirty bit per tracked property. Writes set bits, ConsumeDirty() visits only the properties
+// changed since previous call and clears them, e.g. for incremental serialization or replication.
+// Properties may be written from any thread while the set is consumed, such write is visited either
+// by the current or by the next call. DirtySet must outlive its properties, declare it before them
+class DirtySet {
+public:
+    DirtySet() = default;
+    DirtySet(const DirtySet&) = delete;
+    DirtySet& operator=(const DirtySet&) = delete;
+
+    // Binds the property to the next bit and returns its index. Must not race with writes or ConsumeDirty()
+    template <typename P>
+    std::size_t Track(P& property) {
+        using Hooks = typename P::Hooks;
+        static_assert(std::is_base_of_v<DirtyTracked, Hooks>, "Track requires DirtyTracked hook policy");
+
+        const std::size_t index = m_Size++;
+        if (index / WordBits == m_Words.size()) {
+            m_Words.emplace_back(0);
+        }
+
+        std::lock_guard<typename P::Mutex> lock(detail::PropertyAccess::GetMutex(property));
+        DirtyTracked& hooks = detail::PropertyAccess::GetHooks(property);
+        hooks.m_Set = this;
+        hooks.m_Index = index;
+        return index;
+    }
+
+    void Mark(std::size_t index) {
+        std::atomic<std::uint64_t>& word = m_Words[index / WordBits];
+        const std::uint64_t bit = std::uint64_t(1) << (index % WordBits);
+        // Repeated writes of already dirty property only read the word and don't contend on it
+        if ((word.load(std::memory_order_relaxed) & bit) == 0) {
+            word.fetch_or(bit, std::memory_order_release);
+        }
+    }
+
+    bool IsDirty(std::size_t index) const {
+        const std::uint64_t bit = std::uint64_t(1) << (index % WordBits);
+        return (m_Words[index / WordBits].load(std::memory_order_acquire) & bit) != 0;
+    }
+
+    bool Any() const {
+        for (const auto& word : m_Words) {
+            if (word.load(std::memory_order_acquire) != 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Calls `visitor(index)` for every dirty property and clears its bit, returns number of visited properties
+    template <typename Visitor>
+    std::size_t ConsumeDirty(Visitor&& visitor) {
+        std::size_t visited = 0;
+        for (std::size_t w = 0; w < m_Words.size(); ++w) {
+            if (m_Words[w].load(std::memory_order_relaxed) == 0) {
+                continue;
+            }
+            std::uint64_t bits = m_Words[w].exchange(0, std::memory_order_acq_rel);
+            while (bits != 0) {
+                visitor(w * WordBits + detail::CountTrailingZeros(bits));
+                bits &= bits - 1;
+                ++visited;
+            }
+        }
+        return visited;
+    }
+
+    // Marks every tracked property dirty, e.g. to send full state to a new client
+    void MarkAll() {
+        for (std::size_t index = 0; index < m_Size; ++index) {
+            Mark(index);
+        }
+    }
+
+    void Clear() {
+        for (auto& word : m_Words) {
+            word.store(0, std::memory_order_release);
+        }
+    }
+
+    std::size_t Size() const { return m_Size; }
+
+private:
+    static constexpr std::size_t WordBits = 64;
+
+    // Deque keeps words in place when new properties are tracked
+    std::deque<std::atomic<std::uint64_t>> m_Words;
+    std::size_t m_Size = 0;
+};
+
+inline void DirtyTracked::OnChanged() {
+    if (m_Set) {
+        m_Set->Mark(m_Index);
+    }
+}
+
+// Dirty-tracked variant of the property, e.g. Tracked<PropertyRWMT<int>>
+template <typename P>
+using Tracked = WithHooks<P, DirtyTracked>;
+
+} // namespace propp
@@ -0,0 +1,203 @@
+#pragma once
+
+#include "propp/Property.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#ifndef PROPP_LOCK_STRIPES
+#define PROPP_LOCK_STRIPES 64
+#endif
+
+namespace propp {
+
+struct LockDomainStats {
+    std::uint64_t Acquisitions = 0;
+    std::uint64_t Contended = 0;     // acquisitions that had to wait
+};
+
+// Recursive lock shared by several properties, e.g. all MT properties of one owner. Writing several
+// properties of the domain under one lock keeps invariants between them:
+//
+//     std::lock_guard<LockDomain> lock(account.Domain);
+//     account.Balance -= amount;
+//     account.Reserved += amount;
+//
+// Counters are updated only by the thread holding the lock, so they cost no extra synchronization
+class LockDomain {
+public:
+    LockDomain() = default;
+    LockDomain(const LockDomain&) = delete;
+    LockDomain& operator=(const LockDomain&) = delete;
+
+    void lock() {
+        if (!m_Mutex.try_lock()) {
+            m_Mutex.lock();
+            Bump(m_Contended);
+        }
+        Bump(m_Acquisitions);
+    }
+
+    bool try_lock() {
+        if (!m_Mutex.try_lock()) {
+            return false;
+        }
+        Bump(m_Acquisitions);
+        return true;
+    }
+
+    void unlock() { m_Mutex.unlock(); }
+
+    LockDomainStats Stats() const {
+        LockDomainStats stats;
+        stats.Acquisitions = m_Acquisitions.load(std::memory_order_relaxed);
+        stats.Contended = m_Contended.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    void ResetStats() {
+        m_Acquisitions.store(0, std::memory_order_relaxed);
+        m_Contended.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    static void Bump(std::atomic<std::uint64_t>& counter) {
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    std::recursive_mutex m_Mutex;
+    std::atomic<std::uint64_t> m_Acquisitions{0};
+    std::atomic<std::uint64_t> m_Contended{0};
+};
+
+// K lock domains shared by any number of properties, property is mapped to a stripe by its address.
+// Stripes take whole cache lines. Stats() shows how evenly the stripes are used and how often they
+// are contended, more stripes reduce contention of unrelated properties that land on the same stripe
+class StripedLockTable {
+public:
+    explicit StripedLockTable(std::size_t stripes = PROPP_LOCK_STRIPES)
+        : m_Stripes(new Stripe[stripes > 0 ? stripes : 1])
+        , m_Size(stripes > 0 ? stripes : 1)
+    {
+    }
+
+    StripedLockTable(const StripedLockTable&) = delete;
+    StripedLockTable& operator=(const StripedLockTable&) = delete;
+
+    // Table used by StripedLock and by unbound DomainLock properties, PROPP_LOCK_STRIPES stripes
+    static StripedLockTable& Default() {
+        static StripedLockTable table;
+        return table;
+    }
+
+    std::size_t Size() const { return m_Size; }
+
+    // Fibonacci hashing spreads neighbouring members of one object over different stripes
+    std::size_t IndexOf(const void* address) const {
+        const std::uint64_t hash = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(address) >> 3) * 0x9E3779B97F4A7C15ull;
+        return static_cast<std::size_t>((hash >> 32) % m_Size);
+    }
+
+    LockDomain& For(const void* address) { return m_Stripes[IndexOf(address)].m_Domain; }
+    LockDomain& At(std::size_t index) { return m_Stripes[index].m_Domain; }
+
+    std::vector<LockDomainStats> Stats() const {
+        std::vector<LockDomainStats> stats;
+        stats.reserve(m_Size);
+        for (std::size_t i = 0; i < m_Size; ++i) {
+            stats.push_back(m_Stripes[i].m_Domain.Stats());
+        }
+        return stats;
+    }
+
+    void ResetStats() {
+        for (std::size_t i = 0; i < m_Size; ++i) {
+            m_Stripes[i].m_Domain.ResetStats();
+        }
+    }
+
+private:
+    struct alignas(detail::CacheLineSize) Stripe {
+        LockDomain m_Domain;
+    };
+
+    std::unique_ptr<Stripe[]> m_Stripes;
+    std::size_t m_Size;
+};
+
+namespace detail {
+
+// Mutex of DomainLock property, pointer to the bound domain. Unbound property uses the stripe of
+// the default table picked by its address
+class DomainMutex {
+public:
+    void lock() { Target().lock(); }
+    bool try_lock() { return Target().try_lock(); }
+    void unlock() { Target().unlock(); }
+
+    void Bind(LockDomain& domain) { m_Domain = &domain; }
+
+    LockDomain& Target() { return m_Domain ? *m_Domain : StripedLockTable::Default().For(this); }
+
+private:
+    LockDomain* m_Domain = nullptr;
+};
+
+// Mutex of StripedLock property, takes no space and picks the stripe by its own address
+class StripedMutex {
+public:
+    void lock() { Target().lock(); }
+    bool try_lock() { return Target().try_lock(); }
+    void unlock() { Target().unlock(); }
+
+    LockDomain& Target() { return StripedLockTable::Default().For(this); }
+};
+
+} // namespace detail
+
+// Properties lock LockDomain they were bound to with BindLockDomain(), copy of the property is unbound
+struct DomainLock {
+    using Mutex = detail::DomainMutex;
+    using ReadLock = std::lock_guard<Mutex>;
+};
+
+// Properties lock one of StripedLockTable::Default() stripes and keep no mutex, so
+// sizeof(PropertyRWStripedMT<int>) == sizeof(int)
+struct StripedLock {
+    using Mutex = detail::StripedMutex;
+    using ReadLock = std::lock_guard<Mutex>;
+};
+
+// Binds DomainLock properties to `domain`. Must be done before the properties are used by other threads,
+// e.g. in the owner's constructor
+template <typename... Properties>
+void BindLockDomain(LockDomain& domain, Properties&... properties) {
+    (detail::PropertyAccess::GetMutex(properties).Bind(domain), ...);
+}
+
+// Binds DomainLock properties to stripes of `table` picked by their addresses
+template <typename... Properties>
+void BindLockDomain(StripedLockTable& table, Properties&... properties) {
+    (detail::PropertyAccess::GetMutex(properties).Bind(table.For(&properties)), ...);
+}
+
+// Read-write property, multi-threaded, no getter or setter, locks the domain it is bound to
+template <typename T>
+using PropertyRWDomainMT = Property<T, false, true, NoGetter, NoSetter, DomainLock>;
+
+// Read-only property, multi-threaded, no getter or setter, locks the domain it is bound to
+template <typename T>
+using PropertyRODomainMT = Property<T, true, true, NoGetter, NoSetter, DomainLock>;
+
+// Read-write property, multi-threaded, no getter or setter, locks a stripe of the default lock table
+template <typename T>
+using PropertyRWStripedMT = Property<T, false, true, NoGetter, NoSetter, StripedLock>;
+
+// Read-only property, multi-threaded, no getter or setter, locks a stripe of the default lock table
+template <typename T>
+using PropertyROStripedMT = Property<T, true, true, NoGetter, NoSetter, StripedLock>;
+
+} // namespace propp
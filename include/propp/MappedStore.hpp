@@ -0,0 +1,728 @@
+#pragma once
+
+#include "propp/Column.hpp"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace propp {
+
+namespace detail {
+
+// Read-write file that can be mapped into memory as a whole, errors are thrown as std::system_error
+class NativeFile {
+public:
+    explicit NativeFile(const std::filesystem::path& path) {
+#ifdef _WIN32
+        m_File = ::CreateFileW(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, OPEN_ALWAYS,
+            FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (m_File == INVALID_HANDLE_VALUE) {
+            Fail("open " + path.string());
+        }
+#else
+        m_File = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+        if (m_File < 0) {
+            Fail("open " + path.string());
+        }
+#endif
+    }
+
+    ~NativeFile() {
+        Unmap();
+#ifdef _WIN32
+        ::CloseHandle(m_File);
+#else
+        ::close(m_File);
+#endif
+    }
+
+    NativeFile(const NativeFile&) = delete;
+    NativeFile& operator=(const NativeFile&) = delete;
+
+    std::uint64_t Size() const {
+#ifdef _WIN32
+        LARGE_INTEGER size;
+        if (!::GetFileSizeEx(m_File, &size)) {
+            Fail("stat");
+        }
+        return static_cast<std::uint64_t>(size.QuadPart);
+#else
+        struct stat info;
+        if (::fstat(m_File, &info) != 0) {
+            Fail("stat");
+        }
+        return static_cast<std::uint64_t>(info.st_size);
+#endif
+    }
+
+    // File must not be mapped
+    void Resize(std::uint64_t size) {
+#ifdef _WIN32
+        LARGE_INTEGER offset;
+        offset.QuadPart = static_cast<LONGLONG>(size);
+        if (!::SetFilePointerEx(m_File, offset, nullptr, FILE_BEGIN) || !::SetEndOfFile(m_File)) {
+            Fail("resize");
+        }
+#else
+        if (::ftruncate(m_File, static_cast<off_t>(size)) != 0) {
+            Fail("resize");
+        }
+#endif
+    }
+
+    void Append(const void* data, std::size_t size) {
+        const auto* bytes = static_cast<const char*>(data);
+#ifdef _WIN32
+        LARGE_INTEGER offset{};
+        if (!::SetFilePointerEx(m_File, offset, nullptr, FILE_END)) {
+            Fail("seek");
+        }
+        while (size > 0) {
+            DWORD written = 0;
+            const DWORD chunk = size > 0x40000000 ? 0x40000000 : static_cast<DWORD>(size);
+            if (!::WriteFile(m_File, bytes, chunk, &written, nullptr)) {
+                Fail("write");
+            }
+            bytes += written;
+            size -= written;
+        }
+#else
+        if (::lseek(m_File, 0, SEEK_END) < 0) {
+            Fail("seek");
+        }
+        while (size > 0) {
+            const ssize_t written = ::write(m_File, bytes, size);
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                Fail("write");
+            }
+            bytes += written;
+            size -= static_cast<std::size_t>(written);
+        }
+#endif
+    }
+
+    std::vector<std::uint8_t> ReadAll() const {
+        std::vector<std::uint8_t> data(static_cast<std::size_t>(Size()));
+        std::size_t offset = 0;
+#ifdef _WIN32
+        LARGE_INTEGER begin{};
+        if (!::SetFilePointerEx(m_File, begin, nullptr, FILE_BEGIN)) {
+            Fail("seek");
+        }
+        while (offset < data.size()) {
+            DWORD read = 0;
+            const std::size_t left = data.size() - offset;
+            const DWORD chunk = left > 0x40000000 ? 0x40000000 : static_cast<DWORD>(left);
+            if (!::ReadFile(m_File, data.data() + offset, chunk, &read, nullptr)) {
+                Fail("read");
+            }
+            if (read == 0) {
+                break;
+            }
+            offset += read;
+        }
+#else
+        while (offset < data.size()) {
+            const ssize_t read = ::pread(m_File, data.data() + offset, data.size() - offset, static_cast<off_t>(offset));
+            if (read < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                Fail("read");
+            }
+            if (read == 0) {
+                break;
+            }
+            offset += static_cast<std::size_t>(read);
+        }
+#endif
+        data.resize(offset);
+        return data;
+    }
+
+    // Waits until written data and the mapping reach the disk
+    void Sync() {
+#ifdef _WIN32
+        if (m_View && !::FlushViewOfFile(m_View, 0)) {
+            Fail("flush");
+        }
+        if (!::FlushFileBuffers(m_File)) {
+            Fail("sync");
+        }
+#else
+        if (m_View && ::msync(m_View, m_ViewSize, MS_SYNC) != 0) {
+            Fail("flush");
+        }
+        if (::fsync(m_File) != 0) {
+            Fail("sync");
+        }
+#endif
+    }
+
+    // Maps the whole file shared, previous mapping is released
+    std::uint8_t* Map() {
+        Unmap();
+        const std::size_t size = static_cast<std::size_t>(Size());
+#ifdef _WIN32
+        m_Mapping = ::CreateFileMappingW(m_File, nullptr, PAGE_READWRITE, 0, 0, nullptr);
+        if (!m_Mapping) {
+            Fail("map");
+        }
+        m_View = ::MapViewOfFile(m_Mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+        if (!m_View) {
+            Fail("map");
+        }
+#else
+        void* view = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, m_File, 0);
+        if (view == MAP_FAILED) {
+            Fail("map");
+        }
+        m_View = view;
+#endif
+        m_ViewSize = size;
+        return static_cast<std::uint8_t*>(m_View);
+    }
+
+    void Unmap() {
+        if (!m_View) {
+            return;
+        }
+#ifdef _WIN32
+        ::UnmapViewOfFile(m_View);
+        ::CloseHandle(m_Mapping);
+        m_Mapping = nullptr;
+#else
+        ::munmap(m_View, m_ViewSize);
+#endif
+        m_View = nullptr;
+        m_ViewSize = 0;
+    }
+
+private:
+    [[noreturn]] static void Fail(const std::string& what) {
+#ifdef _WIN32
+        throw std::system_error(static_cast<int>(::GetLastError()), std::system_category(), "propp: " + what);
+#else
+        throw std::system_error(errno, std::generic_category(), "propp: " + what);
+#endif
+    }
+
+#ifdef _WIN32
+    HANDLE m_File = INVALID_HANDLE_VALUE;
+    HANDLE m_Mapping = nullptr;
+#else
+    int m_File = -1;
+#endif
+    void* m_View = nullptr;
+    std::size_t m_ViewSize = 0;
+};
+
+// Column file starts with the header, values follow at HeaderSize
+struct MappedHeader {
+    char m_Magic[8];
+    std::uint32_t m_Version;
+    std::uint32_t m_ElementSize;
+    std::uint32_t m_ElementAlignment;
+    std::uint32_t m_Reserved;
+    std::uint64_t m_Count;
+};
+
+inline constexpr std::size_t MappedHeaderSize = 64;
+inline constexpr char MappedMagic[8] = { 'P', 'R', 'O', 'P', 'P', 'C', 'O', 'L' };
+inline constexpr std::uint32_t MappedVersion = 1;
+
+// Journal records, payload follows the header. Checksum covers the header with zero checksum and the payload
+enum class JournalKind : std::uint32_t {
+    Segment = 1,    // payload is the column name, m_Offset is element size and m_Value is element alignment
+    Write = 2,      // payload is written at byte offset m_Offset of values
+    Count = 3,      // m_Value is new number of values
+};
+
+struct JournalRecord {
+    JournalKind m_Kind;
+    std::uint32_t m_Segment;
+    std::uint64_t m_Offset;
+    std::uint64_t m_Value;
+    std::uint64_t m_PayloadSize;
+    std::uint64_t m_Checksum;
+};
+
+inline std::uint64_t Fnv1a(const void* data, std::size_t size, std::uint64_t hash = 14695981039346656037ull) {
+    const auto* bytes = static_cast<const std::uint8_t*>(data);
+    for (std::size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * 1099511628211ull;
+    }
+    return hash;
+}
+
+inline std::uint64_t JournalChecksum(JournalRecord record, const void* payload, std::size_t size) {
+    record.m_Checksum = 0;
+    return Fnv1a(payload, size, Fnv1a(&record, sizeof(record)));
+}
+
+// Mapped column file. Growing remaps the file, so pointers into it are valid until the column is resized
+class MappedSegment {
+public:
+    MappedSegment(const std::filesystem::path& path, std::uint32_t elementSize, std::uint32_t elementAlignment)
+        : m_File(path)
+        , m_ElementSize(elementSize)
+    {
+        const std::uint64_t size = m_File.Size();
+        if (size < MappedHeaderSize) {
+            m_File.Resize(MappedHeaderSize);
+        }
+        m_Data = m_File.Map();
+        MappedHeader& header = Header();
+        static constexpr char blank[sizeof(MappedMagic)] = {};
+        // Header of a new file may be lost by a crash together with its values, journal restores them
+        if (size < MappedHeaderSize || std::memcmp(header.m_Magic, blank, sizeof(blank)) == 0) {
+            std::memcpy(header.m_Magic, MappedMagic, sizeof(MappedMagic));
+            header.m_Version = MappedVersion;
+            header.m_ElementSize = elementSize;
+            header.m_ElementAlignment = elementAlignment;
+            header.m_Count = 0;
+            return;
+        }
+        if (std::memcmp(header.m_Magic, MappedMagic, sizeof(MappedMagic)) != 0 || header.m_Version != MappedVersion) {
+            throw std::runtime_error("propp: " + path.string() + " isn't a column file");
+        }
+        if (header.m_ElementSize != elementSize || header.m_ElementAlignment != elementAlignment) {
+            throw std::runtime_error("propp: column file " + path.string() + " holds values of another type");
+        }
+        if (header.m_Count > Capacity()) {
+            // Extension of the file was lost by a crash
+            Grow(static_cast<std::size_t>(header.m_Count));
+        }
+    }
+
+    MappedHeader& Header() { return *reinterpret_cast<MappedHeader*>(m_Data); }
+    std::uint8_t* Values() { return m_Data + MappedHeaderSize; }
+
+    std::size_t Capacity() const {
+        return static_cast<std::size_t>((m_File.Size() - MappedHeaderSize) / m_ElementSize);
+    }
+
+    void Grow(std::size_t capacity) {
+        m_File.Unmap();
+        m_Data = nullptr;
+        m_File.Resize(MappedHeaderSize + static_cast<std::uint64_t>(capacity) * m_ElementSize);
+        m_Data = m_File.Map();
+    }
+
+    void Sync() { m_File.Sync(); }
+
+private:
+    NativeFile m_File;
+    std::uint8_t* m_Data = nullptr;
+    std::size_t m_ElementSize;
+};
+
+// State shared by the store and its columns, journal records of all columns go to one file,
+// so Commit() is a single durability point for every column
+class MappedStoreState {
+public:
+    MappedStoreState(std::filesystem::path directory, bool journaled, std::uint64_t journalLimit)
+        : m_Directory(std::move(directory))
+        , m_JournalLimit(journalLimit)
+    {
+        std::filesystem::create_directories(m_Directory);
+        if (journaled) {
+            m_Journal = std::make_unique<NativeFile>(m_Directory / "journal");
+            Recover();
+        }
+    }
+
+    ~MappedStoreState() {
+        try {
+            Checkpoint();
+        } catch (...) {
+            // Journal is replayed on next start
+        }
+    }
+
+    bool Journaled() const { return m_Journal != nullptr; }
+
+    std::shared_ptr<MappedSegment> Open(const std::string& name, std::uint32_t elementSize, std::uint32_t elementAlignment, std::uint32_t& id) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        for (const Entry& entry : m_Segments) {
+            if (entry.m_Name == name && !entry.m_Closed) {
+                throw std::logic_error("propp: column " + name + " is already open");
+            }
+        }
+        auto segment = std::make_shared<MappedSegment>(SegmentPath(name), elementSize, elementAlignment);
+        id = static_cast<std::uint32_t>(m_Segments.size());
+        m_Segments.push_back(Entry{ name, elementSize, elementAlignment, segment, false });
+        return segment;
+    }
+
+    void Close(std::uint32_t id) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (!m_Journal) {
+            m_Segments[id].m_Segment->Sync();
+        }
+        // Journal may still refer to the column, it's kept open until the next checkpoint
+        m_Segments[id].m_Closed = true;
+    }
+
+    // Mapping of the segment is replaced under the store lock, so checkpoints never flush a stale mapping
+    void Grow(MappedSegment& segment, std::size_t capacity) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        segment.Grow(capacity);
+    }
+
+    void LogWrite(std::uint32_t id, std::uint64_t offset, const void* data, std::size_t size) {
+        if (m_Journal) {
+            Log(id, JournalKind::Write, offset, 0, data, size);
+        }
+    }
+
+    void LogCount(std::uint32_t id, std::uint64_t count) {
+        if (m_Journal) {
+            Log(id, JournalKind::Count, 0, count, nullptr, 0);
+        }
+    }
+
+    // Every journaled write made before the call survives a crash. Without journal flushes the mappings
+    void Commit() {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        if (!m_Journal) {
+            SyncSegments();
+            return;
+        }
+        WritePending();
+        m_Journal->Sync();
+        if (m_Journal->Size() > m_JournalLimit) {
+            CheckpointLocked();
+        }
+    }
+
+    // Flushes all mappings to disk and empties the journal
+    void Checkpoint() {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        CheckpointLocked();
+    }
+
+private:
+    struct Entry {
+        std::string m_Name;
+        std::uint32_t m_ElementSize;
+        std::uint32_t m_ElementAlignment;
+        std::shared_ptr<MappedSegment> m_Segment;
+        bool m_Declared;
+        bool m_Closed = false;
+    };
+
+    std::filesystem::path SegmentPath(const std::string& name) const { return m_Directory / (name + ".column"); }
+
+    void Log(std::uint32_t id, JournalKind kind, std::uint64_t offset, std::uint64_t value, const void* data, std::size_t size) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        Entry& entry = m_Segments[id];
+        if (!entry.m_Declared) {
+            // Name appears once per journal generation, recovery opens the file by it
+            Append(JournalKind::Segment, id, entry.m_ElementSize, entry.m_ElementAlignment, entry.m_Name.data(), entry.m_Name.size());
+            entry.m_Declared = true;
+        }
+        Append(kind, id, offset, value, data, size);
+        if (m_Pending.size() >= PendingLimit) {
+            WritePending();
+        }
+    }
+
+    void Append(JournalKind kind, std::uint32_t id, std::uint64_t offset, std::uint64_t value, const void* payload, std::size_t payloadSize) {
+        JournalRecord record{ kind, id, offset, value, payloadSize, 0 };
+        record.m_Checksum = JournalChecksum(record, payload, payloadSize);
+        const auto* header = reinterpret_cast<const std::uint8_t*>(&record);
+        m_Pending.insert(m_Pending.end(), header, header + sizeof(record));
+        if (payloadSize > 0) {
+            const auto* bytes = static_cast<const std::uint8_t*>(payload);
+            m_Pending.insert(m_Pending.end(), bytes, bytes + payloadSize);
+        }
+    }
+
+    void WritePending() {
+        if (!m_Pending.empty()) {
+            m_Journal->Append(m_Pending.data(), m_Pending.size());
+            m_Pending.clear();
+        }
+    }
+
+    void SyncSegments() {
+        for (const Entry& entry : m_Segments) {
+            if (entry.m_Segment) {
+                entry.m_Segment->Sync();
+            }
+        }
+    }
+
+    // Values written before the lock was taken are in the mappings, flushing them makes the journal redundant
+    void CheckpointLocked() {
+        SyncSegments();
+        if (!m_Journal) {
+            return;
+        }
+        m_Pending.clear();
+        m_Journal->Resize(0);
+        m_Journal->Sync();
+        for (Entry& entry : m_Segments) {
+            entry.m_Declared = false;
+            if (entry.m_Closed) {
+                entry.m_Segment.reset();
+            }
+        }
+    }
+
+    // Replays complete records of the journal left by a crash, torn record at the end is dropped
+    void Recover() {
+        const std::vector<std::uint8_t> journal = m_Journal->ReadAll();
+        if (journal.empty()) {
+            return;
+        }
+        std::unordered_map<std::uint32_t, std::unique_ptr<MappedSegment>> segments;
+        std::size_t offset = 0;
+        while (journal.size() - offset >= sizeof(JournalRecord)) {
+            JournalRecord record;
+            std::memcpy(&record, journal.data() + offset, sizeof(record));
+            if (record.m_PayloadSize > journal.size() - offset - sizeof(record)) {
+                break;
+            }
+            const std::size_t payloadSize = static_cast<std::size_t>(record.m_PayloadSize);
+            const std::uint8_t* payload = journal.data() + offset + sizeof(record);
+            if (JournalChecksum(record, payload, payloadSize) != record.m_Checksum) {
+                break;
+            }
+            offset += sizeof(record) + payloadSize;
+
+            if (record.m_Kind == JournalKind::Segment) {
+                const std::string name(reinterpret_cast<const char*>(payload), payloadSize);
+                segments[record.m_Segment] = std::make_unique<MappedSegment>(SegmentPath(name),
+                    static_cast<std::uint32_t>(record.m_Offset), static_cast<std::uint32_t>(record.m_Value));
+                continue;
+            }
+            auto found = segments.find(record.m_Segment);
+            if (found == segments.end()) {
+                break;
+            }
+            MappedSegment& segment = *found->second;
+            const std::size_t elementSize = segment.Header().m_ElementSize;
+            if (record.m_Kind == JournalKind::Count) {
+                if (record.m_Value > segment.Capacity()) {
+                    segment.Grow(static_cast<std::size_t>(record.m_Value));
+                }
+                segment.Header().m_Count = record.m_Value;
+            } else if (record.m_Kind == JournalKind::Write) {
+                const std::size_t end = static_cast<std::size_t>((record.m_Offset + payloadSize + elementSize - 1) / elementSize);
+                if (end > segment.Capacity()) {
+                    segment.Grow(end);
+                }
+                std::memcpy(segment.Values() + record.m_Offset, payload, payloadSize);
+            } else {
+                break;
+            }
+        }
+        for (auto& segment : segments) {
+            segment.second->Sync();
+        }
+        m_Journal->Resize(0);
+        m_Journal->Sync();
+    }
+
+    static constexpr std::size_t PendingLimit = 1 << 20;
+
+    std::filesystem::path m_Directory;
+    std::uint64_t m_JournalLimit;
+    std::unique_ptr<NativeFile> m_Journal;
+
+    std::mutex m_Mutex;
+    std::vector<Entry> m_Segments;
+    std::vector<std::uint8_t> m_Pending;
+};
+
+} // namespace detail
+
+// Values of a column kept in a memory-mapped file, storage of PropertyColumnMapped. Restart maps the
+// file again, values aren't parsed or constructed. Growing remaps the file, like reallocation of std::vector
+template <typename T>
+class MappedVector {
+public:
+    static_assert(std::is_trivially_copyable_v<T>, "Mapped values must be trivially copyable");
+    static_assert(alignof(T) <= detail::MappedHeaderSize, "Mapped values must be aligned to at most 64 bytes");
+
+    using value_type = T;
+
+    MappedVector(std::shared_ptr<detail::MappedStoreState> store, const std::string& name)
+        : m_Store(std::move(store))
+        , m_Id(0)
+        , m_Segment(m_Store->Open(name, sizeof(T), alignof(T), m_Id))
+    {
+    }
+
+    MappedVector(MappedVector&& other) noexcept
+        : m_Store(std::move(other.m_Store))
+        , m_Id(other.m_Id)
+        , m_Segment(std::move(other.m_Segment))
+    {
+    }
+
+    ~MappedVector() {
+        if (m_Store) {
+            m_Store->Close(m_Id);
+        }
+    }
+
+    MappedVector(const MappedVector&) = delete;
+    MappedVector& operator=(const MappedVector&) = delete;
+    MappedVector& operator=(MappedVector&&) = delete;
+
+    std::size_t size() const { return static_cast<std::size_t>(m_Segment->Header().m_Count); }
+    std::size_t capacity() const { return m_Segment->Capacity(); }
+    bool empty() const { return size() == 0; }
+
+    T* data() { return reinterpret_cast<T*>(m_Segment->Values()); }
+    const T* data() const { return reinterpret_cast<const T*>(m_Segment->Values()); }
+
+    T& operator[](std::size_t i) { return data()[i]; }
+    const T& operator[](std::size_t i) const { return data()[i]; }
+
+    T& back() { return data()[size() - 1]; }
+    const T& back() const { return data()[size() - 1]; }
+
+    T* begin() { return data(); }
+    T* end() { return data() + size(); }
+    const T* begin() const { return data(); }
+    const T* end() const { return data() + size(); }
+
+    void reserve(std::size_t capacity) {
+        if (capacity > this->capacity()) {
+            m_Store->Grow(*m_Segment, capacity);
+        }
+    }
+
+    void resize(std::size_t size) { resize(size, T()); }
+
+    void resize(std::size_t size, const T& value) {
+        const std::size_t current = this->size();
+        if (size > current) {
+            reserve(size);
+            for (std::size_t i = current; i < size; ++i) {
+                new (data() + i) T(value);
+            }
+            Written(current, size - current);
+        }
+        SetCount(size);
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        const std::size_t row = size();
+        if (row == capacity()) {
+            reserve(row < 8 ? 16 : row * 2);
+        }
+        T* value = new (data() + row) T(std::forward<Args>(args)...);
+        Written(row, 1);
+        SetCount(row + 1);
+        return *value;
+    }
+
+    void pop_back() { SetCount(size() - 1); }
+    void clear() { SetCount(0); }
+
+    // Called by the column after rows were modified in place, journals their new values
+    void Written(std::size_t first, std::size_t count) {
+        if (count > 0) {
+            m_Store->LogWrite(m_Id, static_cast<std::uint64_t>(first) * sizeof(T), data() + first, count * sizeof(T));
+        }
+    }
+
+private:
+    void SetCount(std::size_t count) {
+        m_Segment->Header().m_Count = count;
+        m_Store->LogCount(m_Id, count);
+    }
+
+    std::shared_ptr<detail::MappedStoreState> m_Store;
+    // Declared before the segment, Open() assigns the id while the segment is initialized
+    std::uint32_t m_Id;
+    std::shared_ptr<detail::MappedSegment> m_Segment;
+};
+
+// Directory of memory-mapped column files, one `<name>.column` file per column. Values are written
+// straight into the mappings and the OS writes them back, so they survive process crashes.
+// Journaled store additionally logs every write; after power loss all writes made before the last
+// Commit() are restored on open, later writes may be partially present.
+//
+//     MappedPropertyStore store("state", MappedPropertyStore::Journaled);
+//     PropertyColumnMapped<float> scores(store.Open<float>("scores"));
+//     scores[i] = 1.0f;
+//     store.Commit();
+//
+// Writes through Data() of the column bypass the journal
+class MappedPropertyStore {
+public:
+    enum Durability {
+        Mapped,     // writes reach the disk when the OS flushes the mappings or on Commit()
+        Journaled,  // writes are also logged to the journal, Commit() makes them durable
+    };
+
+    explicit MappedPropertyStore(const std::filesystem::path& directory, Durability durability = Mapped,
+                                 std::uint64_t journalLimit = 64 << 20)
+        : m_State(std::make_shared<detail::MappedStoreState>(directory, durability == Journaled, journalLimit))
+    {
+    }
+
+    MappedPropertyStore(const MappedPropertyStore&) = delete;
+    MappedPropertyStore& operator=(const MappedPropertyStore&) = delete;
+
+    // Opens or creates the column file, throws if it holds values of another size or alignment.
+    // Column may outlive the store
+    template <typename T>
+    MappedVector<T> Open(const std::string& name) {
+        return MappedVector<T>(m_State, name);
+    }
+
+    // Makes every write made so far durable. Journal is checkpointed once it grows over the limit
+    void Commit() { m_State->Commit(); }
+
+    // Flushes all columns to disk and empties the journal
+    void Checkpoint() { m_State->Checkpoint(); }
+
+private:
+    std::shared_ptr<detail::MappedStoreState> m_State;
+};
+
+// Column with values kept in a memory-mapped file, e.g. PropertyColumnMapped<float> c(store.Open<float>("c"))
+template <typename T, typename GetterType = NoGetter, typename SetterType = NoSetter, typename LockPolicy = NoLock>
+using PropertyColumnMapped = PropertyColumn<T, GetterType, SetterType, LockPolicy, MappedVector<T>>;
+
+} // namespace propp
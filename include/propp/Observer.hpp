@@ -0,0 +1,229 @@
+#pragma once
+
+#include "propp/Property.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <vector>
+
+namespace propp {
+
+class ChangeQueue;
+
+namespace detail {
+
+// Subscription delivered through ChangeQueue. Pending flag coalesces writes made between flushes
+struct QueuedDelivery {
+    std::function<void()> m_Deliver;
+    ChangeQueue* m_Queue = nullptr;
+    std::atomic<bool> m_Pending{false};
+    std::atomic<bool> m_Active{true};
+};
+
+class ObserverHub;
+
+} // namespace detail
+
+// Collects changes of subscribed properties and delivers them in batches. Writers only mark
+// subscription pending, Flush() invokes every pending subscription once with the latest value.
+// Flush() can be called from any thread, e.g. once per frame, but must not race with destruction
+// of subscribed properties
+class ChangeQueue {
+public:
+    ChangeQueue() = default;
+    ChangeQueue(const ChangeQueue&) = delete;
+    ChangeQueue& operator=(const ChangeQueue&) = delete;
+
+    // Delivers pending notifications, returns number of invoked subscriptions
+    std::size_t Flush() {
+        std::vector<std::shared_ptr<detail::QueuedDelivery>> batch;
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            batch.swap(m_Pending);
+        }
+
+        std::size_t delivered = 0;
+        for (const auto& delivery : batch) {
+            // Cleared before the callback, so writes made by the callback are delivered by next flush
+            delivery->m_Pending.store(false, std::memory_order_release);
+            if (delivery->m_Active.load(std::memory_order_acquire)) {
+                delivery->m_Deliver();
+                ++delivered;
+            }
+        }
+        return delivered;
+    }
+
+    std::size_t Pending() const {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_Pending.size();
+    }
+
+private:
+    friend class detail::ObserverHub;
+
+    void Enqueue(std::shared_ptr<detail::QueuedDelivery> delivery) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Pending.push_back(std::move(delivery));
+    }
+
+    mutable std::mutex m_Mutex;
+    std::vector<std::shared_ptr<detail::QueuedDelivery>> m_Pending;
+};
+
+namespace detail {
+
+// Listeners of one property. Listeners may subscribe and unsubscribe from their own callbacks,
+// removed listeners are erased once notification finishes
+class ObserverHub {
+public:
+    ~ObserverHub() {
+        for (Listener& listener : m_Listeners) {
+            if (listener.m_Queued) {
+                listener.m_Queued->m_Active.store(false, std::memory_order_release);
+            }
+        }
+    }
+
+    std::uint64_t Add(std::function<void()> deliver, ChangeQueue* queue) {
+        std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+        Listener listener;
+        listener.m_Id = m_NextId++;
+        if (queue) {
+            listener.m_Queued = std::make_shared<QueuedDelivery>();
+            listener.m_Queued->m_Deliver = std::move(deliver);
+            listener.m_Queued->m_Queue = queue;
+        } else {
+            listener.m_Deliver = std::move(deliver);
+        }
+        m_Listeners.push_back(std::move(listener));
+        return m_Listeners.back().m_Id;
+    }
+
+    void Remove(std::uint64_t id) {
+        std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+        for (Listener& listener : m_Listeners) {
+            if (listener.m_Id == id) {
+                listener.m_Id = 0;
+                if (listener.m_Queued) {
+                    listener.m_Queued->m_Active.store(false, std::memory_order_release);
+                }
+                break;
+            }
+        }
+        m_HasRemoved = true;
+        Compact();
+    }
+
+    void Notify() {
+        std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+        ++m_Notifying;
+        // Listeners added by callbacks are notified next time. Deque keeps elements in place on push_back
+        const std::size_t count = m_Listeners.size();
+        for (std::size_t i = 0; i < count; ++i) {
+            Listener& listener = m_Listeners[i];
+            if (listener.m_Id == 0) {
+                continue;
+            }
+            if (listener.m_Queued) {
+                if (!listener.m_Queued->m_Pending.exchange(true, std::memory_order_acq_rel)) {
+                    listener.m_Queued->m_Queue->Enqueue(listener.m_Queued);
+                }
+            } else {
+                listener.m_Deliver();
+            }
+        }
+        --m_Notifying;
+        Compact();
+    }
+
+private:
+    struct Listener {
+        std::uint64_t m_Id = 0;
+        std::function<void()> m_Deliver;
+        std::shared_ptr<QueuedDelivery> m_Queued;
+    };
+
+    void Compact() {
+        if (m_Notifying == 0 && m_HasRemoved) {
+            m_Listeners.erase(std::remove_if(m_Listeners.begin(), m_Listeners.end(),
+                [](const Listener& listener) { return listener.m_Id == 0; }), m_Listeners.end());
+            m_HasRemoved = false;
+        }
+    }
+
+    std::recursive_mutex m_Mutex;
+    std::deque<Listener> m_Listeners;
+    std::uint64_t m_NextId = 1;
+    unsigned m_Notifying = 0;
+    bool m_HasRemoved = false;
+};
+
+} // namespace detail
+
+// Handle of subscription returned by Property::Subscribe, unsubscribes when destroyed or reset
+class Subscription {
+public:
+    Subscription() = default;
+    Subscription(std::weak_ptr<detail::ObserverHub> hub, std::uint64_t id) : m_Hub(std::move(hub)), m_Id(id) {}
+    ~Subscription() { Reset(); }
+
+    Subscription(Subscription&& other) noexcept : m_Hub(std::move(other.m_Hub)), m_Id(other.m_Id) { other.m_Id = 0; }
+    Subscription& operator=(Subscription&& other) noexcept {
+        if (this != &other) {
+            Reset();
+            m_Hub = std::move(other.m_Hub);
+            m_Id = other.m_Id;
+            other.m_Id = 0;
+        }
+        return *this;
+    }
+
+    Subscription(const Subscription&) = delete;
+    Subscription& operator=(const Subscription&) = delete;
+
+    void Reset() {
+        if (m_Id != 0) {
+            if (auto hub = m_Hub.lock()) {
+                hub->Remove(m_Id);
+            }
+            m_Hub.reset();
+            m_Id = 0;
+        }
+    }
+
+    explicit operator bool() const { return m_Id != 0; }
+
+private:
+    std::weak_ptr<detail::ObserverHub> m_Hub;
+    std::uint64_t m_Id = 0;
+};
+
+// Hook policy that lets the property be observed with Subscribe(). Listener list is allocated on first
+// subscription, until then property pays only for a null check per write
+class Observable {
+public:
+    void OnChanged() {
+        if (m_Hub) {
+            m_Hub->Notify();
+        }
+    }
+
+    Subscription AddListener(std::function<void()> deliver, ChangeQueue* queue) {
+        if (!m_Hub) {
+            m_Hub = std::make_shared<detail::ObserverHub>();
+        }
+        return Subscription(m_Hub, m_Hub->Add(std::move(deliver), queue));
+    }
+
+private:
+    std::shared_ptr<detail::ObserverHub> m_Hub;
+};
+
+// Observable variant of the property, e.g. Observed<PropertyRWMT<int>>
+template <typename P>
+using Observed = WithHooks<P, Observable>;
+
+} // namespace propp
@@ -0,0 +1,277 @@
+#pragma once
+
+#include "propp/Column.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace propp {
+
+namespace detail {
+
+// Splits `count` elements of `elementSize` bytes starting at `base` into about `chunks` ranges. Boundaries
+// fall on cache line boundaries when the layout allows it, so neighbouring chunks never write the same line
+inline std::vector<std::size_t> ChunkBoundaries(const void* base, std::size_t elementSize, std::size_t count, std::size_t chunks) {
+    // Every `granule` elements the layout repeats relative to cache lines
+    const std::size_t granule = CacheLineSize / std::gcd(elementSize, CacheLineSize);
+
+    std::size_t first = 0;
+    const auto address = reinterpret_cast<std::uintptr_t>(base);
+    while (first < granule && (address + first * elementSize) % CacheLineSize != 0) {
+        ++first;
+    }
+    if (first == granule) {
+        first = 0; // elements never start at a line boundary
+    }
+
+    std::size_t size = (count + chunks - 1) / std::max<std::size_t>(chunks, 1);
+    size = std::max(granule, (size + granule - 1) / granule * granule);
+
+    std::vector<std::size_t> boundaries{0};
+    for (std::size_t end = first + size; end < count; end += size) {
+        boundaries.push_back(end);
+    }
+    boundaries.push_back(count);
+    return boundaries;
+}
+
+} // namespace detail
+
+// Work-stealing thread pool. Every worker has its own queue, tasks submitted by a worker go to its queue
+// and idle workers steal from the others. Threads waiting for parallel loops run queued tasks meanwhile,
+// so loops may be nested
+class ThreadPool {
+public:
+    explicit ThreadPool(std::size_t threads = std::max(1u, std::thread::hardware_concurrency())) {
+        m_Queues.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i) {
+            m_Queues.push_back(std::make_unique<Queue>());
+        }
+        m_Threads.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i) {
+            m_Threads.emplace_back([this, i]() { Run(i); });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(m_SleepMutex);
+            m_Stop = true;
+        }
+        m_Wake.notify_all();
+        for (std::thread& thread : m_Threads) {
+            thread.join();
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Pool shared by parallel algorithms when no pool is given, one thread per hardware thread
+    static ThreadPool& Default() {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    std::size_t Size() const { return m_Threads.size(); }
+
+    void Submit(std::function<void()> task) {
+        const std::size_t index = WorkerIndex() < m_Queues.size() ? WorkerIndex()
+            : m_NextQueue.fetch_add(1, std::memory_order_relaxed) % m_Queues.size();
+        // Counted before it's queued, so the counter never drops below the number of queued tasks
+        {
+            std::lock_guard<std::mutex> lock(m_SleepMutex);
+            ++m_Queued;
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_Queues[index]->m_Mutex);
+            m_Queues[index]->m_Tasks.push_back(std::move(task));
+        }
+        m_Wake.notify_one();
+    }
+
+    // Runs one queued task on the calling thread, returns false if there was none
+    bool RunPending() {
+        std::function<void()> task;
+        const std::size_t index = WorkerIndex() < m_Queues.size() ? WorkerIndex() : 0;
+        if (!Take(index, task)) {
+            return false;
+        }
+        task();
+        return true;
+    }
+
+private:
+    struct Queue {
+        std::mutex m_Mutex;
+        std::deque<std::function<void()>> m_Tasks;
+    };
+
+    // Index of the worker in the pool that owns the calling thread, or Size() for other threads
+    std::size_t WorkerIndex() const {
+        return t_Owner == this ? t_Index : m_Queues.size();
+    }
+
+    // Own queue is used as a stack for locality, other queues are robbed from the front
+    bool Take(std::size_t index, std::function<void()>& task) {
+        {
+            Queue& own = *m_Queues[index];
+            std::lock_guard<std::mutex> lock(own.m_Mutex);
+            if (!own.m_Tasks.empty()) {
+                task = std::move(own.m_Tasks.back());
+                own.m_Tasks.pop_back();
+                OnTaken();
+                return true;
+            }
+        }
+        for (std::size_t offset = 1; offset < m_Queues.size(); ++offset) {
+            Queue& victim = *m_Queues[(index + offset) % m_Queues.size()];
+            std::lock_guard<std::mutex> lock(victim.m_Mutex);
+            if (!victim.m_Tasks.empty()) {
+                task = std::move(victim.m_Tasks.front());
+                victim.m_Tasks.pop_front();
+                OnTaken();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void OnTaken() {
+        std::lock_guard<std::mutex> lock(m_SleepMutex);
+        --m_Queued;
+    }
+
+    void Run(std::size_t index) {
+        t_Owner = this;
+        t_Index = index;
+        std::function<void()> task;
+        for (;;) {
+            if (Take(index, task)) {
+                task();
+                task = nullptr;
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(m_SleepMutex);
+            m_Wake.wait(lock, [this]() { return m_Stop || m_Queued > 0; });
+            if (m_Stop && m_Queued == 0) {
+                return;
+            }
+        }
+    }
+
+    static inline thread_local const ThreadPool* t_Owner = nullptr;
+    static inline thread_local std::size_t t_Index = 0;
+
+    std::vector<std::unique_ptr<Queue>> m_Queues;
+    std::vector<std::thread> m_Threads;
+    std::atomic<std::size_t> m_NextQueue{0};
+
+    std::mutex m_SleepMutex;
+    std::condition_variable m_Wake;
+    std::size_t m_Queued = 0;
+    bool m_Stop = false;
+};
+
+// Calls `body(begin, end)` for disjoint ranges covering [0, count) on the pool and waits for all of them.
+// Ranges follow cache lines of `base` array with `elementSize` bytes per element. First exception thrown
+// by the body is rethrown after every range finished
+template <typename Body>
+void ParallelFor(std::size_t count, Body&& body, const void* base = nullptr, std::size_t elementSize = 1,
+                 ThreadPool& pool = ThreadPool::Default()) {
+    if (count == 0) {
+        return;
+    }
+    // Several chunks per thread let stealing balance uneven work
+    const std::vector<std::size_t> boundaries = detail::ChunkBoundaries(base, elementSize, count, pool.Size() * 4);
+    const std::size_t chunks = boundaries.size() - 1;
+    if (chunks == 1) {
+        body(std::size_t(0), count);
+        return;
+    }
+
+    std::atomic<std::size_t> remaining{chunks};
+    std::exception_ptr error;
+    std::mutex errorMutex;
+    auto run = [&](std::size_t chunk) {
+        try {
+            body(boundaries[chunk], boundaries[chunk + 1]);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+        remaining.fetch_sub(1, std::memory_order_acq_rel);
+    };
+
+    for (std::size_t chunk = 1; chunk < chunks; ++chunk) {
+        pool.Submit([&run, chunk]() { run(chunk); });
+    }
+    run(0);
+    while (remaining.load(std::memory_order_acquire) != 0) {
+        if (!pool.RunPending()) {
+            std::this_thread::yield();
+        }
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+// Calls `operation(T&)` for every row of the column in parallel, like `column.All().Update(operation)`.
+// The column lock is taken once by the calling thread, rows of different chunks are never shared
+template <typename T, typename G, typename S, typename L, typename C, typename Operation>
+void ParallelForEach(PropertyColumn<T, G, S, L, C>& column, Operation&& operation, ThreadPool& pool = ThreadPool::Default()) {
+    using Column = PropertyColumn<T, G, S, L, C>;
+    std::lock_guard<typename Column::Mutex> lock(detail::PropertyAccess::GetMutex(column));
+    ParallelFor(column.Size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t row = begin; row < end; ++row) {
+            detail::PropertyAccess::ApplyST(column, row, operation);
+        }
+    }, column.Data(), sizeof(T), pool);
+}
+
+// Assigns `transform(const T&)` to every row of the column in parallel, the result goes through the setter
+template <typename T, typename G, typename S, typename L, typename C, typename Transform>
+void ParallelTransform(PropertyColumn<T, G, S, L, C>& column, Transform&& transform, ThreadPool& pool = ThreadPool::Default()) {
+    using Column = PropertyColumn<T, G, S, L, C>;
+    std::lock_guard<typename Column::Mutex> lock(detail::PropertyAccess::GetMutex(column));
+    ParallelFor(column.Size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t row = begin; row < end; ++row) {
+            detail::PropertyAccess::SetST(column, row, static_cast<T>(transform(detail::PropertyAccess::GetST(std::as_const(column), row))));
+        }
+    }, column.Data(), sizeof(T), pool);
+}
+
+// Calls `operation(element)` for every element of contiguous container, e.g. std::vector<PropertyRW<int>>.
+// Every element is accessed by one thread only, so single-threaded properties are safe to modify
+template <typename Container, typename Operation>
+void ParallelForEach(Container& container, Operation&& operation, ThreadPool& pool = ThreadPool::Default()) {
+    auto* data = std::data(container);
+    ParallelFor(std::size(container), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            operation(data[i]);
+        }
+    }, data, sizeof(*data), pool);
+}
+
+// Assigns `transform(value)` to every property of contiguous container in parallel
+template <typename Container, typename Transform>
+void ParallelTransform(Container& container, Transform&& transform, ThreadPool& pool = ThreadPool::Default()) {
+    ParallelForEach(container, [&transform](auto& property) { property = transform(std::as_const(property)()); }, pool);
+}
+
+} // namespace propp
@@ -0,0 +1,219 @@
+#pragma once
+
+#include "propp/Property.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace propp {
+
+// Type-erased callable like std::function for getters and setters. Callables up to four pointers, e.g.
+// [this] lambdas and std::bind of a member function and this, are kept inline, larger ones are allocated
+// from the memory resource. The resource travels with the callable: copies allocate from the same
+// resource, so it must outlive them
+template <typename Signature>
+class PmrFunction;
+
+template <typename R, typename... Args>
+class PmrFunction<R(Args...)> {
+public:
+    using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+    PmrFunction() noexcept = default;
+    PmrFunction(std::nullptr_t) noexcept {}
+
+    template <typename F, typename = std::enable_if_t<
+        !std::is_same_v<std::decay_t<F>, PmrFunction> && std::is_invocable_r_v<R, std::decay_t<F>&, Args...>
+    >>
+    PmrFunction(F&& function, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : m_Resource(resource)
+    {
+        Assign(std::forward<F>(function));
+    }
+
+    template <typename F, typename = std::enable_if_t<
+        !std::is_same_v<std::decay_t<F>, PmrFunction> && std::is_invocable_r_v<R, std::decay_t<F>&, Args...>
+    >>
+    PmrFunction(std::allocator_arg_t, const allocator_type& allocator, F&& function)
+        : PmrFunction(std::forward<F>(function), allocator.resource())
+    {
+    }
+
+    PmrFunction(const PmrFunction& other)
+        : m_Resource(other.m_Resource)
+    {
+        if (other.m_Ops) {
+            other.m_Ops->m_Copy(other, *this);
+        }
+    }
+
+    PmrFunction(PmrFunction&& other) noexcept
+        : m_Resource(other.m_Resource)
+    {
+        MoveFrom(other);
+    }
+
+    ~PmrFunction() { Reset(); }
+
+    PmrFunction& operator=(const PmrFunction& other) {
+        if (this != &other) {
+            PmrFunction copy(other);
+            Reset();
+            m_Resource = copy.m_Resource;
+            MoveFrom(copy);
+        }
+        return *this;
+    }
+
+    PmrFunction& operator=(PmrFunction&& other) noexcept {
+        if (this != &other) {
+            Reset();
+            m_Resource = other.m_Resource;
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    PmrFunction& operator=(std::nullptr_t) noexcept {
+        Reset();
+        return *this;
+    }
+
+    explicit operator bool() const noexcept { return m_Ops != nullptr; }
+
+    R operator()(Args... args) const {
+        if (!m_Ops) {
+            throw std::bad_function_call();
+        }
+        return m_Ops->m_Invoke(m_Target, std::forward<Args>(args)...);
+    }
+
+    std::pmr::memory_resource* Resource() const noexcept { return m_Resource; }
+    allocator_type get_allocator() const noexcept { return allocator_type(m_Resource); }
+
+private:
+    static constexpr std::size_t InlineSize = 4 * sizeof(void*);
+
+    template <typename F>
+    static constexpr bool IsInline = sizeof(F) <= InlineSize && alignof(std::max_align_t) % alignof(F) == 0 &&
+        std::is_nothrow_move_constructible_v<F>;
+
+    struct Ops {
+        R (*m_Invoke)(void* target, Args&&... args);
+        void (*m_Copy)(const PmrFunction& from, PmrFunction& to);
+        void (*m_Move)(PmrFunction& from, PmrFunction& to) noexcept;
+        void (*m_Destroy)(PmrFunction& function) noexcept;
+    };
+
+    template <typename F>
+    struct Model {
+        static R Invoke(void* target, Args&&... args) {
+            return std::invoke(*static_cast<F*>(target), std::forward<Args>(args)...);
+        }
+
+        static void Copy(const PmrFunction& from, PmrFunction& to) {
+            to.Assign(*static_cast<const F*>(from.m_Target));
+        }
+
+        static void Move(PmrFunction& from, PmrFunction& to) noexcept {
+            if constexpr (IsInline<F>) {
+                to.m_Target = new (to.m_Buffer) F(std::move(*static_cast<F*>(from.m_Target)));
+                static_cast<F*>(from.m_Target)->~F();
+            } else {
+                to.m_Target = from.m_Target;
+            }
+            to.m_Ops = from.m_Ops;
+            from.m_Target = nullptr;
+            from.m_Ops = nullptr;
+        }
+
+        static void Destroy(PmrFunction& function) noexcept {
+            static_cast<F*>(function.m_Target)->~F();
+            if constexpr (!IsInline<F>) {
+                function.m_Resource->deallocate(function.m_Target, sizeof(F), alignof(F));
+            }
+        }
+
+        static constexpr Ops Table = { &Invoke, &Copy, &Move, &Destroy };
+    };
+
+    template <typename Function>
+    void Assign(Function&& function) {
+        using F = std::decay_t<Function>;
+        if constexpr (std::is_pointer_v<F> || std::is_member_pointer_v<F>) {
+            if (function == nullptr) {
+                return;
+            }
+        }
+        if constexpr (IsInline<F>) {
+            m_Target = new (m_Buffer) F(std::forward<Function>(function));
+        } else {
+            void* memory = m_Resource->allocate(sizeof(F), alignof(F));
+            try {
+                m_Target = new (memory) F(std::forward<Function>(function));
+            } catch (...) {
+                m_Resource->deallocate(memory, sizeof(F), alignof(F));
+                throw;
+            }
+        }
+        m_Ops = &Model<F>::Table;
+    }
+
+    // Heap callables change owner, inline ones are moved into this buffer
+    void MoveFrom(PmrFunction& other) noexcept {
+        if (other.m_Ops) {
+            other.m_Ops->m_Move(other, *this);
+        }
+    }
+
+    void Reset() noexcept {
+        if (m_Ops) {
+            m_Ops->m_Destroy(*this);
+            m_Ops = nullptr;
+            m_Target = nullptr;
+        }
+    }
+
+    alignas(std::max_align_t) unsigned char m_Buffer[InlineSize];
+    void* m_Target = nullptr;
+    const Ops* m_Ops = nullptr;
+    std::pmr::memory_resource* m_Resource = std::pmr::get_default_resource();
+};
+
+template <typename T>
+using GetterTypePmrValue = PmrFunction<T()>;
+template <typename T>
+using GetterTypePmrRef = PmrFunction<T&()>;
+
+template <typename T>
+using SetterTypePmrValue = PmrFunction<void(T)>;
+template <typename T>
+using SetterTypePmrCRef = PmrFunction<void(const T&)>;
+
+namespace detail {
+
+template <typename T>
+struct IsGetterType<PmrFunction<T()>, T> : std::true_type {};
+
+template <typename T>
+struct IsGetterType<PmrFunction<T&()>, T> : std::true_type {};
+
+template <typename T>
+struct IsSetterType<PmrFunction<void(T)>, T> : std::true_type {};
+
+template <typename T>
+struct IsSetterType<PmrFunction<void(const T&)>, T> : std::true_type {};
+
+template <typename T>
+struct GetterResult<PmrFunction<T()>, T> {
+    using type = T;
+};
+
+} // namespace detail
+
+} // namespace propp
@@ -1,6 +1,46 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
 #include <mutex>
+#include <new>
+#include <shared_mutex>
+#include <thread>
 #include <functional>
+#include <memory>
 #include <type_traits>
+#include <utility>
+
+#include "propp/Stats.hpp"
+
+// Lets empty members (no mutex, no getter or setter) take no space in the property
+#if defined(_MSC_VER) && _MSC_VER >= 1929
+#define PROPP_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#define PROPP_HAS_NO_UNIQUE_ADDRESS 1
+#elif defined(__has_cpp_attribute)
+#if __has_cpp_attribute(no_unique_address)
+#define PROPP_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#define PROPP_HAS_NO_UNIQUE_ADDRESS 1
+#endif
+#endif
+#ifndef PROPP_NO_UNIQUE_ADDRESS
+#define PROPP_NO_UNIQUE_ADDRESS
+#define PROPP_HAS_NO_UNIQUE_ADDRESS 0
+#endif
+
+// Size of the cache line used by padded properties and parallel loops, can be defined by the build to
+// keep layout stable across targets. GCC warns about std::hardware_destructive_interference_size in
+// headers because its value depends on tuning flags, so the common value is used there
+#ifndef PROPP_CACHE_LINE_SIZE
+#if defined(__cpp_lib_hardware_interference_size) && !defined(__GNUC__)
+#define PROPP_CACHE_LINE_SIZE std::hardware_destructive_interference_size
+#elif defined(__APPLE__) && defined(__aarch64__)
+#define PROPP_CACHE_LINE_SIZE 128
+#else
+#define PROPP_CACHE_LINE_SIZE 64
+#endif
+#endif
 
 namespace propp {
     
@@ -17,34 +57,763 @@ using SetterTypeValue = std::function<void(T)>;
 struct NoGetter {};
 struct NoSetter {};
 
+// Hook policies are members of the property notified about its changes, `OnChanged()` is called
+// after every write through Set, operators and ApplyOperation while the property lock is held.
+// See Observer.hpp for Observable and DirtySet.hpp for DirtyTracked
+struct NoHooks {
+    void OnChanged() {}
+};
+
+// Combines several hook policies, e.g. HookList<Observable, DirtyTracked>. Policies are notified in order
+template <typename... Policies>
+struct HookList : Policies... {
+    void OnChanged() { (static_cast<Policies&>(*this).OnChanged(), ...); }
+};
+
+namespace detail {
+
+// Mutex that does nothing, lets lock scopes compile away for policies that don't need a mutex
+struct NullMutex {
+    constexpr void lock() {}
+    constexpr bool try_lock() { return true; }
+    constexpr void unlock() {}
+};
+
+// Lock that doesn't lock, used by reads that synchronize through the storage itself
+template <typename Mutex>
+struct NoLockGuard {
+    constexpr explicit NoLockGuard(Mutex&) {}
+};
+
+// Sequence lock storage for small trivially copyable values. Value is kept in relaxed atomic words,
+// readers copy them and retry if the sequence changed, so reads never write to shared cache lines.
+// Writers must be serialized by the caller
+template <typename T>
+class SeqLockCell {
+public:
+    static_assert(std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>,
+        "SeqLock requires trivially copyable and default constructible T");
+
+    SeqLockCell(const T& value = T()) {
+        std::uintptr_t words[Words] = {};
+        std::memcpy(words, &value, sizeof(T));
+        for (std::size_t i = 0; i < Words; ++i) {
+            m_Words[i].store(words[i], std::memory_order_relaxed);
+        }
+    }
+
+    T Load() const {
+        std::uintptr_t words[Words];
+        unsigned begin;
+        unsigned end;
+        do {
+            begin = m_Sequence.load(std::memory_order_acquire);
+            while (begin & 1u) {
+                std::this_thread::yield();
+                begin = m_Sequence.load(std::memory_order_acquire);
+            }
+            for (std::size_t i = 0; i < Words; ++i) {
+                words[i] = m_Words[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            end = m_Sequence.load(std::memory_order_relaxed);
+        } while (begin != end);
+
+        T value;
+        std::memcpy(&value, words, sizeof(T));
+        return value;
+    }
+
+    void Store(const T& value) {
+        std::uintptr_t words[Words] = {};
+        std::memcpy(words, &value, sizeof(T));
+
+        // Odd sequence marks write in progress
+        unsigned sequence = m_Sequence.load(std::memory_order_relaxed);
+        m_Sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (std::size_t i = 0; i < Words; ++i) {
+            m_Words[i].store(words[i], std::memory_order_relaxed);
+        }
+        m_Sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+private:
+    static constexpr std::size_t Words = (sizeof(T) + sizeof(std::uintptr_t) - 1) / sizeof(std::uintptr_t);
+
+    std::atomic<unsigned> m_Sequence{0};
+    std::atomic<std::uintptr_t> m_Words[Words];
+};
+
+// Read-copy-update storage for large values. Readers take shared_ptr snapshot with atomic load,
+// writers publish new value with atomic store, old value is released by whoever drops the last snapshot.
+// Writers must be serialized by the caller
+template <typename T>
+class SnapshotCell {
+public:
+    using Pointer = std::shared_ptr<const T>;
+
+    SnapshotCell(T value = T()) : m_Pointer(std::make_shared<const T>(std::move(value))) {}
+    explicit SnapshotCell(Pointer pointer) : m_Pointer(std::move(pointer)) {}
+
+#if defined(__cpp_lib_atomic_shared_ptr)
+    Pointer Load() const { return m_Pointer.load(std::memory_order_acquire); }
+    void Store(Pointer pointer) { m_Pointer.store(std::move(pointer), std::memory_order_release); }
+
+private:
+    std::atomic<Pointer> m_Pointer;
+#else
+    Pointer Load() const { return std::atomic_load_explicit(&m_Pointer, std::memory_order_acquire); }
+    void Store(Pointer pointer) { std::atomic_store_explicit(&m_Pointer, std::move(pointer), std::memory_order_release); }
+
+private:
+    Pointer m_Pointer;
+#endif
+};
+
+// Reader-writer mutex that can be re-entered by the thread holding exclusive lock,
+// so setters can assign and read the property they are invoked for
+class SharedRecursiveMutex {
+public:
+    void lock() {
+        if (IsOwner()) {
+            ++m_Depth;
+            return;
+        }
+        m_Mutex.lock();
+        m_Owner.store(std::this_thread::get_id(), std::memory_order_relaxed);
+        m_Depth = 1;
+    }
+
+    bool try_lock() {
+        if (IsOwner()) {
+            ++m_Depth;
+            return true;
+        }
+        if (!m_Mutex.try_lock()) {
+            return false;
+        }
+        m_Owner.store(std::this_thread::get_id(), std::memory_order_relaxed);
+        m_Depth = 1;
+        return true;
+    }
+
+    void unlock() {
+        if (--m_Depth == 0) {
+            m_Owner.store(std::thread::id(), std::memory_order_relaxed);
+            m_Mutex.unlock();
+        }
+    }
+
+    void lock_shared() {
+        if (IsOwner()) {
+            ++m_Depth;
+            return;
+        }
+        m_Mutex.lock_shared();
+    }
+
+    bool try_lock_shared() {
+        if (IsOwner()) {
+            ++m_Depth;
+            return true;
+        }
+        return m_Mutex.try_lock_shared();
+    }
+
+    void unlock_shared() {
+        if (IsOwner()) {
+            --m_Depth;
+            return;
+        }
+        m_Mutex.unlock_shared();
+    }
+
+private:
+    // Only the owning thread stores its own id, so relaxed load is enough to recognize it
+    bool IsOwner() const { return m_Owner.load(std::memory_order_relaxed) == std::this_thread::get_id(); }
+
+    std::shared_mutex m_Mutex;
+    std::atomic<std::thread::id> m_Owner;
+    unsigned m_Depth = 0;
+};
+
+} // namespace detail
+
+// Lock policies, `Mutex` is the mutex kept by the property and `ReadLock` is the lock taken by reads
+// that don't invoke a getter. Custom policy can be plugged in by declaring both, mutex must be recursive
+// because setters assign the property they are invoked for
+struct NoLock {                // No synchronization, used by single-threaded properties
+    using Mutex = detail::NullMutex;
+    using ReadLock = detail::NoLockGuard<Mutex>;
+};
+struct RecursiveLock {         // Every access is guarded by std::recursive_mutex
+    using Mutex = std::recursive_mutex;
+    using ReadLock = std::lock_guard<Mutex>;
+};
+struct SharedLock {            // Reads take shared lock, writes take exclusive lock, for read-mostly properties
+    using Mutex = detail::SharedRecursiveMutex;
+    using ReadLock = std::shared_lock<Mutex>;
+};
+struct LockFree {              // Value is kept in std::atomic<T>, requires lock-free T and no getter or setter
+    using Mutex = detail::NullMutex;
+    using ReadLock = std::lock_guard<Mutex>;
+};
+struct SeqLock {               // Readers retry on version mismatch without writing shared memory, writers are serialized
+    using Mutex = std::recursive_mutex;
+    using ReadLock = detail::NoLockGuard<Mutex>;
+};
+struct Snapshot {              // Readers get std::shared_ptr<const T> snapshot without locking, writers publish new copy
+    using Mutex = std::recursive_mutex;
+    using ReadLock = detail::NoLockGuard<Mutex>;
+};
+template <std::size_t Slots = 3>
+struct Buffered {              // Single writer fills the next of `Slots` buffers and publishes it, readers get const T& without waiting
+    using Mutex = detail::NullMutex;
+    using ReadLock = detail::NoLockGuard<Mutex>;
+};
+
+namespace detail {
+
+inline constexpr std::size_t CacheLineSize = PROPP_CACHE_LINE_SIZE;
+
+// Ring of `Slots` buffers written by a single writer. Writer fills the buffer after the latest one and
+// publishes it by bumping the version, readers return reference to the latest buffer without waiting.
+// Reference stays valid until the writer publishes `Slots - 1` more versions: with double buffer until
+// the next write, with triple buffer during the next write too. Reading it later races with the writer,
+// T is trivially copyable so such read sees torn bytes but never freed memory. Writers must be serialized
+// by the caller
+template <typename T, std::size_t Slots>
+class BufferedCell {
+public:
+    static_assert(Slots >= 2, "Buffered requires at least two buffers");
+    static_assert(std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>,
+        "Buffered requires trivially copyable and default constructible T");
+
+    BufferedCell(T value = T()) {
+        m_Slots[0].m_Value = std::move(value);
+    }
+
+    const T& Load() const {
+        return m_Slots[m_Version.load(std::memory_order_acquire) % Slots].m_Value;
+    }
+
+    template <typename U>
+    void Store(U&& value) {
+        const std::uint64_t version = m_Version.load(std::memory_order_relaxed) + 1;
+        m_Slots[version % Slots].m_Value = std::forward<U>(value);
+        m_Version.store(version, std::memory_order_release);
+    }
+
+    std::uint64_t Version() const { return m_Version.load(std::memory_order_acquire); }
+
+private:
+    // Buffer being written doesn't share cache line with the one being read
+    struct alignas(CacheLineSize) Slot {
+        T m_Value{};
+    };
+
+    Slot m_Slots[Slots];
+    alignas(CacheLineSize) std::atomic<std::uint64_t> m_Version{0};
+};
+
+// Result of cached getter, logically const: reads of const property recompute it under the property lock
+template <typename T>
+class CacheCell {
+public:
+    CacheCell() = default;
+    CacheCell(T value) : m_Value(std::move(value)) {}
+
+    const T& Load() const { return m_Value; }
+
+    template <typename U>
+    void Store(U&& value) const { m_Value = std::forward<U>(value); }
+
+private:
+    mutable T m_Value{};
+};
+
+} // namespace detail
+
+// Wraps another lock policy and aligns the value together with its mutex or atomic to a cache line, so
+// neighbouring properties written by different threads don't invalidate each other's line
+template <typename Base = RecursiveLock>
+struct Padded : Base {
+    using Unpadded = Base;
+    static constexpr std::size_t Alignment = detail::CacheLineSize;
+};
+
+namespace detail {
+
+template <typename L>
+struct LockTraits {
+    using Base = L;
+    static constexpr std::size_t Alignment = 1;
+};
+
+template <typename L>
+struct LockTraits<Padded<L>> {
+    using Base = L;
+    static constexpr std::size_t Alignment = Padded<L>::Alignment;
+};
+
+// Number of buffers of Buffered policy, zero for other policies
+template <typename L>
+inline constexpr std::size_t BufferSlots = 0;
+template <std::size_t Slots>
+inline constexpr std::size_t BufferSlots<Buffered<Slots>> = Slots;
+
+} // namespace detail
+
+namespace detail {
+
+template <typename T, typename = void>
+struct IsAlwaysLockFree : std::false_type {};
+
+template <typename T>
+struct IsAlwaysLockFree<T, std::enable_if_t<std::is_trivially_copyable_v<T>>>
+    : std::bool_constant<std::atomic<T>::is_always_lock_free> {};
+
+// Reentrancy flag of getter or setter, empty if property has no getter or setter.
+// Tag keeps getter and setter flags distinct types so both can share address with the value
+template <bool Enabled, typename Tag>
+struct ActiveFlag {
+    mutable bool m_Active = false;
+
+    constexpr operator bool() const { return m_Active; }
+    const ActiveFlag& operator=(bool active) const { m_Active = active; return *this; }
+};
+
+template <typename Tag>
+struct ActiveFlag<false, Tag> {
+    constexpr operator bool() const { return false; }
+    const ActiveFlag& operator=(bool) const { return *this; }
+};
+
+// Member locked by const methods. Empty mutex, e.g. NullMutex, has no state to modify, so it isn't
+// declared mutable and constant properties without a lock can be placed in read-only memory
+template <typename T, bool = std::is_empty_v<T> && !std::is_final_v<T>>
+struct MutableSlot {
+    constexpr T& Get() const { return m_Object; }
+
+    mutable T m_Object;
+};
+
+template <typename T>
+struct MutableSlot<T, true> : T {
+    constexpr T& Get() const { return const_cast<MutableSlot&>(*this); }
+};
+
+// Access to unlocked internals of Property for propp extensions like Transaction
+struct PropertyAccess;
+
+// Right-hand operand of operators converted to T. Values of type T are passed by reference, others,
+// including other properties, are converted before the property takes its lock
+template <typename T, typename F>
+constexpr decltype(auto) AsOperand(const F& value) {
+    if constexpr (std::is_same_v<F, T>) {
+        return (value);
+    } else {
+        return static_cast<T>(value);
+    }
+}
+
+// Types for which std::atomic<T> provides fetch_add, fetch_sub, fetch_and, fetch_or and fetch_xor
+template <typename T>
+inline constexpr bool HasAtomicFetch = std::is_integral_v<T> && !std::is_same_v<T, bool>;
+
+// Owner and result type of member functions used by GetterTypeMethod and SetterTypeMethod
+template <typename M>
+struct MethodTraits;
+
+template <typename R, typename C>
+struct MethodTraits<R (C::*)()> {
+    using Owner = C;
+    using Result = R;
+};
+
+template <typename R, typename C>
+struct MethodTraits<R (C::*)() const> {
+    using Owner = const C;
+    using Result = R;
+};
+
+template <typename R, typename C, typename A>
+struct MethodTraits<R (C::*)(A)> {
+    using Owner = C;
+    using Result = R;
+};
+
+template <typename R, typename C, typename A>
+struct MethodTraits<R (C::*)(A) const> {
+    using Owner = const C;
+    using Result = R;
+};
+
+} // namespace detail
+
+namespace detail {
+
+// Owner of relative binding, binding lives inside the owner, so the offset never is zero
+template <typename Owner>
+Owner* RelativeOwner(const void* binding, std::intptr_t offset) {
+    return reinterpret_cast<Owner*>(reinterpret_cast<std::uintptr_t>(binding) + static_cast<std::uintptr_t>(offset));
+}
+
+inline std::intptr_t RelativeOffset(const void* binding, std::intptr_t owner) {
+    if (owner == 0) {
+        return 0;
+    }
+    return static_cast<std::intptr_t>(static_cast<std::uintptr_t>(owner) - reinterpret_cast<std::uintptr_t>(binding));
+}
+
+} // namespace detail
+
+// Compile-time getter bound to a member function of the owner, e.g. GetterTypeMethod<&Person::GetAge>.
+// The call is resolved at compile time and inlined, property is constructed with the owner pointer
+// instead of std::function. Member function must be declared before the property
+template <auto Method>
+class GetterTypeMethod {
+public:
+    using Owner = typename detail::MethodTraits<decltype(Method)>::Owner;
+
+    GetterTypeMethod(Owner* owner = nullptr) : m_Owner(owner) {}
+
+    explicit operator bool() const { return m_Owner != nullptr; }
+    decltype(auto) operator()() const { return (m_Owner->*Method)(); }
+
+private:
+    Owner* m_Owner;
+};
+
+// Compile-time setter bound to a member function of the owner, e.g. SetterTypeMethod<&Person::SetAge>
+template <auto Method>
+class SetterTypeMethod {
+public:
+    using Owner = typename detail::MethodTraits<decltype(Method)>::Owner;
+
+    SetterTypeMethod(Owner* owner = nullptr) : m_Owner(owner) {}
+
+    explicit operator bool() const { return m_Owner != nullptr; }
+    template <typename U>
+    void operator()(U&& value) const { (m_Owner->*Method)(std::forward<U>(value)); }
+
+private:
+    Owner* m_Owner;
+};
+
+// Getter bound to a member function of the owner by offset from the getter to the owner instead of
+// owner pointer, e.g. GetterTypeRelative<&Person::GetAddress>. Offset stays valid when the owner is
+// copied or moved, so properties with relative getters and setters are copyable and movable.
+// Property must be a direct member of the owner or a member of its nested class and is constructed with
+// the owner pointer. Such property is copied and moved only by the owner's special members, standalone
+// copy would call the member function on whatever lies at the offset from it
+template <auto Method>
+class GetterTypeRelative {
+public:
+    using Owner = typename detail::MethodTraits<decltype(Method)>::Owner;
+
+    // Keeps owner address until the property attaches its own copy
+    GetterTypeRelative(Owner* owner = nullptr) : m_Offset(static_cast<std::intptr_t>(reinterpret_cast<std::uintptr_t>(owner))) {}
+
+    explicit operator bool() const { return m_Offset != 0; }
+    decltype(auto) operator()() const { return (detail::RelativeOwner<Owner>(this, m_Offset)->*Method)(); }
+
+    void Attach() { m_Offset = detail::RelativeOffset(this, m_Offset); }
+
+private:
+    std::intptr_t m_Offset;
+};
+
+// Setter bound to a member function of the owner by offset, see GetterTypeRelative
+template <auto Method>
+class SetterTypeRelative {
+public:
+    using Owner = typename detail::MethodTraits<decltype(Method)>::Owner;
+
+    SetterTypeRelative(Owner* owner = nullptr) : m_Offset(static_cast<std::intptr_t>(reinterpret_cast<std::uintptr_t>(owner))) {}
+
+    explicit operator bool() const { return m_Offset != 0; }
+    template <typename U>
+    void operator()(U&& value) const { (detail::RelativeOwner<Owner>(this, m_Offset)->*Method)(std::forward<U>(value)); }
+
+    void Attach() { m_Offset = detail::RelativeOffset(this, m_Offset); }
+
+private:
+    std::intptr_t m_Offset;
+};
+
+// Compile-time getter implemented by stateless functor `R F::operator()(const T& raw) const`.
+// Returned value of the functor is returned by the property
+template <typename F>
+struct GetterTypeFunctor {
+    static_assert(std::is_empty_v<F> && std::is_default_constructible_v<F>, "Getter functor must be stateless");
+
+    explicit operator bool() const { return true; }
+    template <typename U>
+    decltype(auto) operator()(const U& raw) const { return F{}(raw); }
+};
+
+// Compile-time setter implemented by stateless functor `T F::operator()(const T& newValue) const`.
+// Returned value of the functor is stored in the property
+template <typename F>
+struct SetterTypeFunctor {
+    static_assert(std::is_empty_v<F> && std::is_default_constructible_v<F>, "Setter functor must be stateless");
+
+    explicit operator bool() const { return true; }
+    template <typename U>
+    decltype(auto) operator()(const U& newValue) const { return F{}(newValue); }
+};
+
+namespace detail {
+
+template <typename G, typename T>
+struct IsGetterType : std::bool_constant<
+    std::is_same_v<G, GetterTypeValue<T>> || std::is_same_v<G, GetterTypeRef<T>> || std::is_same_v<G, NoGetter>
+> {};
+
+template <auto Method, typename T>
+struct IsGetterType<GetterTypeMethod<Method>, T> : std::true_type {};
+
+template <auto Method, typename T>
+struct IsGetterType<GetterTypeRelative<Method>, T> : std::true_type {};
+
+template <typename F, typename T>
+struct IsGetterType<GetterTypeFunctor<F>, T> : std::true_type {};
+
+template <typename S, typename T>
+struct IsSetterType : std::bool_constant<
+    std::is_same_v<S, SetterTypeValue<T>> || std::is_same_v<S, SetterTypeCRef<T>> || std::is_same_v<S, NoSetter>
+> {};
+
+template <auto Method, typename T>
+struct IsSetterType<SetterTypeMethod<Method>, T> : std::true_type {};
+
+template <auto Method, typename T>
+struct IsSetterType<SetterTypeRelative<Method>, T> : std::true_type {};
+
+template <typename F, typename T>
+struct IsSetterType<SetterTypeFunctor<F>, T> : std::true_type {};
+
+// Getters and setters that don't refer to the owner by address, properties using them can be copied and moved
+template <typename B>
+inline constexpr bool IsRelocatableBinding = std::is_same_v<B, NoGetter> || std::is_same_v<B, NoSetter>;
+template <auto Method>
+inline constexpr bool IsRelocatableBinding<GetterTypeRelative<Method>> = true;
+template <auto Method>
+inline constexpr bool IsRelocatableBinding<SetterTypeRelative<Method>> = true;
+template <typename F>
+inline constexpr bool IsRelocatableBinding<GetterTypeFunctor<F>> = true;
+template <typename F>
+inline constexpr bool IsRelocatableBinding<SetterTypeFunctor<F>> = true;
+
+// Getters and setters that find the owner by offset, properties using them are relocated only with the owner
+template <typename B>
+inline constexpr bool IsRelativeBinding = false;
+template <auto Method>
+inline constexpr bool IsRelativeBinding<GetterTypeRelative<Method>> = true;
+template <auto Method>
+inline constexpr bool IsRelativeBinding<SetterTypeRelative<Method>> = true;
+
+// Class befriended by properties with relative binding, void for other bindings
+template <typename B>
+struct RelativeBindingOwner {
+    using type = void;
+};
+template <auto Method>
+struct RelativeBindingOwner<GetterTypeRelative<Method>> {
+    using type = std::remove_const_t<typename GetterTypeRelative<Method>::Owner>;
+};
+template <auto Method>
+struct RelativeBindingOwner<SetterTypeRelative<Method>> {
+    using type = std::remove_const_t<typename SetterTypeRelative<Method>::Owner>;
+};
+
+// Relative bindings learn their own address once they are stored in the property
+template <typename B, typename = void>
+struct HasAttach : std::false_type {};
+
+template <typename B>
+struct HasAttach<B, std::void_t<decltype(std::declval<B&>().Attach())>> : std::true_type {};
+
+template <typename B>
+inline void AttachBinding(B& binding) {
+    if constexpr (HasAttach<B>::value) {
+        binding.Attach();
+    }
+}
+
+// Parameter types of disabled copy and move operations, one per declaration that may be disabled
+template <int>
+struct DisabledCopy {};
+
+// Selects the constructor shared by public copy and move and by the owner-only ones
+struct RelocateTag {};
+
+// Values that keep a stateful allocator, e.g. std::pmr::string
+template <typename T, typename = void>
+inline constexpr bool HasAllocator = false;
+
+template <typename T>
+inline constexpr bool HasAllocator<T, std::void_t<typename T::allocator_type, decltype(std::declval<const T&>().get_allocator())>> =
+    std::uses_allocator_v<T, typename T::allocator_type> &&
+    !std::allocator_traits<typename T::allocator_type>::is_always_equal::value;
+
+// Uses-allocator construction, std::make_obj_using_allocator of C++20
+template <typename T, typename Allocator, typename... Args>
+T MakeUsingAllocator(const Allocator& allocator, Args&&... args) {
+    if constexpr (!std::uses_allocator_v<T, Allocator>) {
+        return T(std::forward<Args>(args)...);
+    } else if constexpr (std::is_constructible_v<T, std::allocator_arg_t, const Allocator&, Args&&...>) {
+        return T(std::allocator_arg, allocator, std::forward<Args>(args)...);
+    } else {
+        return T(std::forward<Args>(args)..., allocator);
+    }
+}
+
+// Type returned by the getter, NoGetter and GetterTypeRef return reference to the value
+template <typename G, typename T>
+struct GetterResult {
+    using type = T&;
+};
+
+template <typename T>
+struct GetterResult<GetterTypeValue<T>, T> {
+    using type = T;
+};
+
+template <auto Method, typename T>
+struct GetterResult<GetterTypeMethod<Method>, T> {
+    using type = typename MethodTraits<decltype(Method)>::Result;
+};
+
+template <auto Method, typename T>
+struct GetterResult<GetterTypeRelative<Method>, T> {
+    using type = typename MethodTraits<decltype(Method)>::Result;
+};
+
+template <typename F, typename T>
+struct GetterResult<GetterTypeFunctor<F>, T> {
+    using type = std::invoke_result_t<const F&, const T&>;
+};
+
+template <typename G>
+inline constexpr bool IsFunctorGetter = false;
+template <typename F>
+inline constexpr bool IsFunctorGetter<GetterTypeFunctor<F>> = true;
+
+// Memoizing getter, specialized by GetterTypeCached in Cached.hpp
+template <typename G>
+inline constexpr bool IsCachedGetter = false;
+
+template <typename S>
+inline constexpr bool IsFunctorSetter = false;
+template <typename F>
+inline constexpr bool IsFunctorSetter<SetterTypeFunctor<F>> = true;
+
+// Setter queued on an executor, specialized by SetterTypeAsync in Async.hpp
+template <typename S>
+inline constexpr bool IsAsyncSetter = false;
+
+} // namespace detail
+
 template <typename T, 
     bool ReadOnly, 
     bool ThreadSafe, 
     typename GetterType = GetterTypeRef<T>,
-    typename SetterType = SetterTypeValue<T>
+    typename SetterType = SetterTypeValue<T>,
+    typename LockPolicy = std::conditional_t<ThreadSafe, RecursiveLock, NoLock>,
+    typename HookPolicy = NoHooks
 >
 class Property {
 public:
     using Getter = GetterType;
     using Setter = SetterType;
+    using Lock = LockPolicy;
+    using Hooks = HookPolicy;
+    using Mutex = typename LockPolicy::Mutex;
+    using ValueType = T;
+
+    static constexpr bool IsReadOnly = ReadOnly;
+
+    // Storage is chosen by the wrapped policy of Padded
+    using BaseLock = typename detail::LockTraits<LockPolicy>::Base;
+
+    static constexpr bool IsAtomic = std::is_same_v<BaseLock, LockFree>;
+    static constexpr bool IsSeqLock = std::is_same_v<BaseLock, SeqLock>;
+    // Atomic and sequence lock storage can't hand out references, they return data by value like GetterTypeValue
+    static constexpr bool IsSnapshot = std::is_same_v<BaseLock, Snapshot>;
+    // Buffered storage returns const T& to the latest published buffer
+    static constexpr bool IsBuffered = detail::BufferSlots<BaseLock> != 0;
+    static constexpr bool IsCached = detail::IsCachedGetter<GetterType>;
+    static constexpr bool IsPlainStorage = !IsAtomic && !IsSeqLock && !IsSnapshot && !IsBuffered && !IsCached;
+    using Storage = std::conditional_t<IsAtomic, std::atomic<T>,
+        std::conditional_t<IsSeqLock, detail::SeqLockCell<T>,
+        std::conditional_t<IsSnapshot, detail::SnapshotCell<T>,
+        std::conditional_t<IsBuffered, detail::BufferedCell<T, detail::BufferSlots<BaseLock>>,
+        std::conditional_t<IsCached, detail::CacheCell<T>, T>>>>>;
 
     static_assert(
-        std::is_same_v<GetterType, GetterTypeValue<T>> || std::is_same_v<GetterType, GetterTypeRef<T>> || std::is_same_v<GetterType, NoGetter>,
-        "GetterType must be either std::function<T>, std::function<T&> or NoGetter"
+        detail::IsGetterType<GetterType, T>::value,
+        "GetterType must be either std::function<T>, std::function<T&>, PmrFunction, GetterTypeMethod, GetterTypeRelative, GetterTypeFunctor or NoGetter"
     );
     static_assert(
-        std::is_same_v<SetterType, SetterTypeValue<T>> || std::is_same_v<SetterType, SetterTypeCRef<T>> || std::is_same_v<SetterType, NoSetter>,
-        "SetterType must be std::function<void(T)>, std::function<void(const T&)> or NoSetter"
+        detail::IsSetterType<SetterType, T>::value,
+        "SetterType must be std::function<void(T)>, std::function<void(const T&)>, PmrFunction, SetterTypeMethod, SetterTypeRelative, SetterTypeFunctor or NoSetter"
     );
 
-    // No getter and setter constructor
+    // Snapshot storage returns the snapshot pointer. Cached result is returned by reference only by single-threaded
+    // properties, multi-threaded ones copy it under the lock because another reader may recompute it
+    using Reference = std::conditional_t<IsPlainStorage, typename detail::GetterResult<GetterType, T>::type,
+        std::conditional_t<IsSnapshot, std::shared_ptr<const T>,
+        std::conditional_t<IsBuffered || (IsCached && !ThreadSafe), const T&, T>>>;
+    static constexpr bool ReturnsValue = !std::is_reference_v<Reference>;
+    using ConstReference = std::conditional_t<ReturnsValue, const Reference, const std::remove_reference_t<Reference>&>;
+
+    static_assert(IsSnapshot || std::is_same_v<std::decay_t<Reference>, T>, "Getter must return T, T& or const T&");
+
+    // Getters and setters that capture the owner's address, e.g. std::function with [this], would call the
+    // original owner from a copy, so only properties without them are copyable and movable
+    static constexpr bool IsRelocatable = detail::IsRelocatableBinding<GetterType> && detail::IsRelocatableBinding<SetterType>;
+    static constexpr bool IsAssignable = IsRelocatable && !ReadOnly;
+    // Relative getters and setters are valid only at their offset from the owner, so the property is copied
+    // and moved only by special members of the owner, e.g. defaulted ones, and not standalone
+    static constexpr bool IsOwnerRelocated = detail::IsRelativeBinding<GetterType> || detail::IsRelativeBinding<SetterType>;
+
+    // Read paths take shared lock if the policy allows it. Invoking getter modifies reentrancy flag,
+    // so reads through the getter take exclusive lock
+    using RawReadLock = typename LockPolicy::ReadLock;
+    using ReadLock = std::conditional_t<std::is_same_v<GetterType, NoGetter>, RawReadLock, std::lock_guard<Mutex>>;
+
+    // Plain single-threaded properties without getter, setter and hooks are never counted, so they stay
+    // constexpr in builds with PROPP_ENABLE_STATS
+    static constexpr bool IsCounted = !std::is_same_v<BaseLock, NoLock> || !std::is_same_v<GetterType, NoGetter> ||
+        !std::is_same_v<SetterType, NoSetter> || !std::is_same_v<HookPolicy, NoHooks>;
+    using Stats = std::conditional_t<IsCounted, detail::PropertyStats, detail::NoStats>;
+    template <typename Lock>
+    using StatsGuard = std::conditional_t<IsCounted, detail::StatsGuard<Lock>, detail::NoStatsGuard<Lock>>;
+
+    template <typename L>
+    using RebindLock = Property<T, ReadOnly, ThreadSafe, GetterType, SetterType, L, HookPolicy>;
+    template <typename H>
+    using RebindHooks = Property<T, ReadOnly, ThreadSafe, GetterType, SetterType, LockPolicy, H>;
+
+    static_assert(ThreadSafe != std::is_same_v<BaseLock, NoLock>, "NoLock must be used only with single-threaded properties");
+    static_assert(
+        !IsAtomic || (detail::IsAlwaysLockFree<T>::value && std::is_same_v<GetterType, NoGetter> && std::is_same_v<SetterType, NoSetter>),
+        "LockFree requires std::atomic<T> to be always lock-free and no getter or setter"
+    );
+    static_assert(!IsSeqLock || std::is_same_v<GetterType, NoGetter>, "SeqLock requires no getter");
+    static_assert(!IsSnapshot || std::is_same_v<GetterType, NoGetter>, "Snapshot requires no getter");
+    static_assert(!IsBuffered || std::is_same_v<GetterType, NoGetter>, "Buffered requires no getter");
+    static_assert(!IsAtomic || std::is_same_v<HookPolicy, NoHooks>, "LockFree writes bypass the lock and can't notify hooks");
+
+    // No getter and setter constructor, constexpr for literal T unless PROPP_ENABLE_STATS registers the property
     template <typename G = GetterType, typename S = SetterType, typename = std::enable_if_t<
         std::is_same_v<S, NoSetter> && std::is_same_v<G, NoGetter>
     >>
-    Property(const T& value = T())
-        : m_Value(value)
-        , m_SetterActive(false)
-        , m_GetterActive(false)
+    constexpr Property(T value = T())
+        : m_Value(std::move(value))
     {
     }
     
@@ -52,363 +821,647 @@ public:
     template <typename G = GetterType, typename S = SetterType, typename = std::enable_if_t<
         std::is_same_v<S, NoSetter>
     >>
-    Property(const T& value, const Getter& getter)
-        : m_Value(value)
-        , m_Getter(getter)
-        , m_SetterActive(false)
-        , m_GetterActive(false)
+    Property(T value, Getter getter)
+        : m_Value(std::move(value))
+        , m_Getter(std::move(getter))
     {
+        detail::AttachBinding(m_Getter);
     }
     
     // Setter only constructor
     template <typename G = GetterType, typename S = SetterType, typename = std::enable_if_t<
         std::is_same_v<G, NoGetter>
     >>
-    Property(const T& value, const Setter& setter)
-        : m_Value(value)
-        , m_Setter(setter)
-        , m_SetterActive(false)
-        , m_GetterActive(false)
+    Property(T value, Setter setter)
+        : m_Value(std::move(value))
+        , m_Setter(std::move(setter))
     {
+        detail::AttachBinding(m_Setter);
     }
     
-    // Getter and setter constructor
-    Property(const T& value, const Getter& getter, const Setter& setter)
-        : m_Value(value)
-        , m_Getter(getter)
-        , m_Setter(setter)
-        , m_SetterActive(false)
-        , m_GetterActive(false)
+    // Cached getter constructor, the value is computed on first read
+    template <typename G = GetterType, typename S = SetterType, typename = std::enable_if_t<
+        detail::IsCachedGetter<G> && std::is_same_v<S, NoSetter>
+    >>
+    explicit Property(Getter getter)
+        : m_Getter(std::move(getter))
     {
     }
 
-    // Non copyable
-    Property() = default;
-    Property(const Property&) = delete;
-    Property& operator=(const Property&) = delete;
+    // Getter and setter constructor. Getter and setter are taken by value, so closures passed as
+    // temporaries are moved into the property rather than copied
+    Property(T value, Getter getter, Setter setter)
+        : m_Value(std::move(value))
+        , m_Getter(std::move(getter))
+        , m_Setter(std::move(setter))
+    {
+        detail::AttachBinding(m_Getter);
+        detail::AttachBinding(m_Setter);
+    }
 
-    // Type conversion operators
-    operator T() { return Get(); }
-    
-    template <typename G = GetterType, typename = std::enable_if_t<
-        std::is_same_v<G, GetterTypeValue<T>>
+    // Allocator-extended constructor, the value is constructed from `args` with the allocator,
+    // e.g. PropertyRW<std::pmr::string> Name{std::allocator_arg, &arena, "Alice"}
+    template <typename Allocator, typename... Args, typename G = GetterType, typename S = SetterType, typename = std::enable_if_t<
+        std::is_same_v<S, NoSetter> && std::is_same_v<G, NoGetter>
     >>
-    T operator*() {
-        return Get();
+    Property(std::allocator_arg_t, const Allocator& allocator, Args&&... args)
+        : m_Value(detail::MakeUsingAllocator<T>(allocator, std::forward<Args>(args)...))
+    {
     }
 
-    template <typename G = GetterType, typename = std::enable_if_t<
-        std::is_same_v<G, GetterTypeValue<T>>
-    >>
-    const T operator*() const {
-        return Get();
+    Property() = default;
+
+    // Copy and move take the raw value without invoking getter and setter, assignment notifies hooks.
+    // Hook policies and subscriptions stay with the original property. Properties with relative getters and
+    // setters are copied and moved only together with the owner, see IsOwnerRelocated. Properties with other
+    // getters and setters are neither copyable nor movable, read-only properties are copyable but not assignable
+    constexpr Property(std::conditional_t<IsRelocatable && !IsOwnerRelocated, const Property&, const detail::DisabledCopy<0>&> other)
+        : Property(other, detail::RelocateTag{})
+    {
     }
 
-    template <typename G = GetterType, typename = std::enable_if_t<
-        std::is_same_v<G, GetterTypeValue<T>>
-    >>
-    T operator()() {
-        return Get();
+    Property(std::conditional_t<IsRelocatable && !IsOwnerRelocated, Property&&, detail::DisabledCopy<0>&&> other) noexcept(std::is_nothrow_move_constructible_v<T>)
+        : Property(std::move(other), detail::RelocateTag{})
+    {
     }
 
-    template <typename G = GetterType, typename = std::enable_if_t<
-        std::is_same_v<G, GetterTypeValue<T>>
-    >>
-    const T operator()() const {
-        return Get();
+    Property& operator=(std::conditional_t<IsAssignable && !IsOwnerRelocated, const Property&, const detail::DisabledCopy<0>&> other) {
+        return CopyAssign(other);
     }
 
-    // Case 2: If GetterType is GetterTypeRef, return by reference
-    template <typename G = GetterType, typename = std::enable_if_t<
-        std::is_same_v<G, GetterTypeRef<T>> || std::is_same_v<G, NoGetter>
-    >>
-    T& operator*() {
+    Property& operator=(std::conditional_t<IsAssignable && !IsOwnerRelocated, Property&&, detail::DisabledCopy<0>&&> other) {
+        return MoveAssign(std::move(other));
+    }
+
+    Property(std::conditional_t<IsRelocatable, const detail::DisabledCopy<1>&, const Property&>) = delete;
+    Property(std::conditional_t<IsRelocatable, detail::DisabledCopy<1>&&, Property&&>) = delete;
+    Property& operator=(std::conditional_t<IsAssignable, const detail::DisabledCopy<1>&, const Property&>) = delete;
+    Property& operator=(std::conditional_t<IsAssignable, detail::DisabledCopy<1>&&, Property&&>) = delete;
+
+    // Type conversion operators
+    constexpr operator T() const { return Read([](const T& v) { return v; }); }
+    
+    Reference operator*() {
         return Get();
     }
 
-    template <typename G = GetterType, typename = std::enable_if_t<
-        std::is_same_v<G, GetterTypeRef<T>> || std::is_same_v<G, NoGetter>
-    >>
-    const T& operator*() const {
+    constexpr ConstReference operator*() const {
         return Get();
     }
 
-    template <typename G = GetterType, typename = std::enable_if_t<
-        std::is_same_v<G, GetterTypeRef<T>> || std::is_same_v<G, NoGetter>
-    >>
-    T& operator()() {
+    Reference operator()() {
         return Get();
     }
 
-    template <typename G = GetterType, typename = std::enable_if_t<
-        std::is_same_v<G, GetterTypeRef<T>> || std::is_same_v<G, NoGetter>
-    >>
-    const T& operator()() const {
+    constexpr ConstReference operator()() const {
         return Get();
     }
 
     // Get raw value
-    template <typename G = GetterType, typename = std::enable_if_t<
-        std::is_same_v<G, GetterTypeValue<T>>
-    >>
-    inline T GetRaw() {
-        if constexpr (ThreadSafe) {
-            std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+    inline Reference GetRaw() {
+        RawReadLock lock(m_Mutex.Get());
+        if constexpr (IsPlainStorage) {
+            return m_Value;
+        } else {
+            return LoadValue();
         }
-        return m_Value;
     }
     
-    template <typename G = GetterType, typename = std::enable_if_t<
-        std::is_same_v<G, GetterTypeValue<T>>
-    >>
-    inline const T GetRaw() const {
-        if constexpr (ThreadSafe) {
-            std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+    constexpr ConstReference GetRaw() const {
+        RawReadLock lock(m_Mutex.Get());
+        if constexpr (IsPlainStorage) {
+            return m_Value;
+        } else {
+            return LoadValue();
         }
-        return m_Value;
     }
 
-    template <typename G = GetterType, typename = std::enable_if_t<
-        std::is_same_v<G, GetterTypeRef<T>> || std::is_same_v<G, NoGetter>
-    >>
-    inline T& GetRaw() {
-        if constexpr (ThreadSafe) {
-            std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+    // Assignment operators, rvalues are moved into the property
+    template <typename F, bool RO = ReadOnly, typename std::enable_if<!RO && !std::is_same_v<std::decay_t<F>, Property>, int>::type = 0>
+    Property& operator=(F&& value) {
+        if constexpr (std::is_same_v<std::decay_t<F>, T>) {
+            Set(std::forward<F>(value));
+        } else {
+            Set(static_cast<T>(std::forward<F>(value)));
         }
-        return m_Value;
+        return *this;
     }
-    
-    template <typename G = GetterType, typename = std::enable_if_t<
-        std::is_same_v<G, GetterTypeRef<T>> || std::is_same_v<G, NoGetter>
-    >>
-    inline const T& GetRaw() const {
-        if constexpr (ThreadSafe) {
-            std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+
+    // Constructs new value from `args`, in place when the property has no setter and plain storage.
+    // Allocator-aware value is constructed with the allocator of the current value, so it stays in its arena
+    template <typename... Args, bool RO = ReadOnly, typename std::enable_if<!RO, int>::type = 0>
+    Property& Emplace(Args&&... args) {
+        std::lock_guard<Mutex> lock(m_Mutex.Get());
+        if constexpr (IsPlainStorage && detail::HasAllocator<T>) {
+            SetST(detail::MakeUsingAllocator<T>(m_Value.get_allocator(), std::forward<Args>(args)...));
+        } else if constexpr (IsSnapshot && std::is_same_v<SetterType, NoSetter>) {
+            m_Value.Store(std::make_shared<const T>(std::forward<Args>(args)...));
+            OnChangedST();
+        } else if constexpr (IsPlainStorage && std::is_same_v<SetterType, NoSetter> && std::is_nothrow_constructible_v<T, Args&&...>) {
+            m_Value.~T();
+            new (&m_Value) T(std::forward<Args>(args)...);
+            OnChangedST();
+        } else {
+            SetST(T(std::forward<Args>(args)...));
         }
-        return m_Value;
+        return *this;
+    }
+
+    // Modifies copy of the value and assigns it back in one locked operation, same as compound operators.
+    // For snapshot properties this is the read-copy-update write, e.g. Routes.Update([](auto& r) { r.push_back(x); })
+    template <typename Operation, bool RO = ReadOnly, typename std::enable_if<!RO, int>::type = 0>
+    Property& Update(Operation&& operation) {
+        return ApplyOperation(std::forward<Operation>(operation));
+    }
+
+    // Subscribes `callback(const T&)` to changes of the property, requires Observable hook policy (Observer.hpp).
+    // Callback is invoked right after every write while the property lock is held.
+    // Returned subscription unsubscribes when destroyed
+    template <typename Callback>
+    auto Subscribe(Callback callback) {
+        static_assert(!std::is_same_v<HookPolicy, NoHooks>, "Subscribe requires Observable hook policy");
+        std::lock_guard<Mutex> lock(m_Mutex.Get());
+        return m_Hooks.AddListener([this, callback]() { ReadST(callback); }, nullptr);
+    }
+
+    // Subscribes `callback(const T&)` to changes delivered by `queue`. Writes only mark the subscription
+    // pending, queue invokes callback once with the latest value on Flush() no matter how many writes happened
+    template <typename Queue, typename Callback>
+    auto Subscribe(Queue& queue, Callback callback) {
+        static_assert(!std::is_same_v<HookPolicy, NoHooks>, "Subscribe requires Observable hook policy");
+        std::lock_guard<Mutex> lock(m_Mutex.Get());
+        return m_Hooks.AddListener([this, callback]() { Read(callback); }, &queue);
+    }
+
+    // Drops cached getter result, next read recomputes it. Doesn't take the lock and may be called from any thread
+    template <typename G = GetterType, typename std::enable_if<detail::IsCachedGetter<G>, int>::type = 0>
+    void Invalidate() const {
+        m_Getter.Invalidate();
     }
 
-    // Assignment operators
-    template <typename F, bool RO = ReadOnly, typename std::enable_if<!RO, int>::type = 0>
-    Property& operator=(const F& value) {
-        Set(static_cast<T>(value));
+    // Invalidates cached getter result whenever `dependency` changes. GetterTypeCached subscribes to Observable
+    // dependency (Observer.hpp), GetterTypeReactive links it into reactive graph (Reactive.hpp)
+    template <typename Dependency, typename G = GetterType, typename std::enable_if<detail::IsCachedGetter<G>, int>::type = 0>
+    Property& DependsOn(Dependency& dependency) {
+        std::lock_guard<Mutex> lock(m_Mutex.Get());
+        m_Getter.AddDependency(dependency);
+        m_Getter.Invalidate();
         return *this;
     }
 
-    // Getter and setter
+    // Number of versions published by Buffered writer since construction. Reference returned by a read
+    // stays valid until the version grows by `Slots - 1`, readers may check it to detect a slow frame
+    template <bool B = IsBuffered, typename std::enable_if<B, int>::type = 0>
+    std::uint64_t Version() const {
+        return m_Value.Version();
+    }
+
+    // Waits until queued async setter calls have finished and rethrows exception thrown by the setter since
+    // the last flush. Doesn't take the lock, must not be called from the setter itself
+    template <typename S = SetterType, typename std::enable_if<detail::IsAsyncSetter<S>, int>::type = 0>
+    void Flush() const {
+        m_Setter.Flush();
+    }
+
+    // Groups statistics of this property under `name` in StatsRegistry, properties sharing a name are
+    // counted together. Does nothing unless PROPP_ENABLE_STATS is defined or the property is not counted
+    Property& StatsName(const std::string& name) {
+        std::lock_guard<Mutex> lock(m_Mutex.Get());
+        m_Stats.SetName(name);
+        return *this;
+    }
+
+    // Getter and setter, only properties declared with them can replace them
+    template <typename G = GetterType, typename std::enable_if<!std::is_same_v<G, NoGetter>, int>::type = 0>
     void SetGetter(const Getter& customGetter) {
-        if constexpr (ThreadSafe) {
-            std::lock_guard<std::recursive_mutex> lock(m_Mutex);
-        }
-        if constexpr (std::is_same_v<GetterType, NoGetter>) {
-            m_Getter = customGetter; // TODO: Throw error
-        }
+        std::lock_guard<Mutex> lock(m_Mutex.Get());
+        m_Getter = customGetter;
+        detail::AttachBinding(m_Getter);
     }
 
-    template <bool RO = ReadOnly, typename std::enable_if<!RO, int>::type = 0>
+    template <bool RO = ReadOnly, typename S = SetterType, typename std::enable_if<!RO && !std::is_same_v<S, NoSetter>, int>::type = 0>
     void SetSetter(const Setter& customSetter) {
-        if constexpr (ThreadSafe) {
-            std::lock_guard<std::recursive_mutex> lock(m_Mutex);
-        }
-        if constexpr (std::is_same_v<SetterType, NoSetter>) {
-            m_Setter = customSetter; // TODO: Throw error
-        }
+        std::lock_guard<Mutex> lock(m_Mutex.Get());
+        m_Setter = customSetter;
+        detail::AttachBinding(m_Setter);
     }
 
     // Arithmetic operators
     template <typename F>
-    Property& operator+=(const F& value) { return ApplyOperation([&](T& v) { v += static_cast<T>(value); }); }
+    Property& operator+=(const F& value) {
+        if constexpr (IsAtomic && detail::HasAtomicFetch<T>) {
+            m_Value.fetch_add(static_cast<T>(value), std::memory_order_acq_rel);
+            m_Stats.OnWrite();
+            return *this;
+        }
+        auto&& rhs = detail::AsOperand<T>(value);
+        return ApplyOperation([&rhs](T& v) { v += rhs; });
+    }
     template <typename F>
-    Property& operator-=(const F& value) { return ApplyOperation([&](T& v) { v -= static_cast<T>(value); }); }
+    Property& operator-=(const F& value) {
+        if constexpr (IsAtomic && detail::HasAtomicFetch<T>) {
+            m_Value.fetch_sub(static_cast<T>(value), std::memory_order_acq_rel);
+            m_Stats.OnWrite();
+            return *this;
+        }
+        auto&& rhs = detail::AsOperand<T>(value);
+        return ApplyOperation([&rhs](T& v) { v -= rhs; });
+    }
     template <typename F>
-    Property& operator*=(const F& value) { return ApplyOperation([&](T& v) { v *= static_cast<T>(value); }); }
+    Property& operator*=(const F& value) { auto&& rhs = detail::AsOperand<T>(value); return ApplyOperation([&rhs](T& v) { v *= rhs; }); }
     template <typename F>
-    Property& operator/=(const F& value) { return ApplyOperation([&](T& v) { v /= static_cast<T>(value); }); }
+    Property& operator/=(const F& value) { auto&& rhs = detail::AsOperand<T>(value); return ApplyOperation([&rhs](T& v) { v /= rhs; }); }
     template <typename F>
-    Property& operator%=(const F& value) { return ApplyOperation([&](T& v) { v %= static_cast<T>(value); }); }
+    Property& operator%=(const F& value) { auto&& rhs = detail::AsOperand<T>(value); return ApplyOperation([&rhs](T& v) { v %= rhs; }); }
     
     // Bitwise operators
     template <typename F>
-    Property& operator&=(const F& value) { return ApplyOperation([&](T& v) { v &= static_cast<T>(value); }); }
+    Property& operator&=(const F& value) {
+        if constexpr (IsAtomic && detail::HasAtomicFetch<T>) {
+            m_Value.fetch_and(static_cast<T>(value), std::memory_order_acq_rel);
+            m_Stats.OnWrite();
+            return *this;
+        }
+        auto&& rhs = detail::AsOperand<T>(value);
+        return ApplyOperation([&rhs](T& v) { v &= rhs; });
+    }
     template <typename F>
-    Property& operator|=(const F& value) { return ApplyOperation([&](T& v) { v |= static_cast<T>(value); }); }
+    Property& operator|=(const F& value) {
+        if constexpr (IsAtomic && detail::HasAtomicFetch<T>) {
+            m_Value.fetch_or(static_cast<T>(value), std::memory_order_acq_rel);
+            m_Stats.OnWrite();
+            return *this;
+        }
+        auto&& rhs = detail::AsOperand<T>(value);
+        return ApplyOperation([&rhs](T& v) { v |= rhs; });
+    }
     template <typename F>
-    Property& operator^=(const F& value) { return ApplyOperation([&](T& v) { v ^= static_cast<T>(value); }); }
+    Property& operator^=(const F& value) {
+        if constexpr (IsAtomic && detail::HasAtomicFetch<T>) {
+            m_Value.fetch_xor(static_cast<T>(value), std::memory_order_acq_rel);
+            m_Stats.OnWrite();
+            return *this;
+        }
+        auto&& rhs = detail::AsOperand<T>(value);
+        return ApplyOperation([&rhs](T& v) { v ^= rhs; });
+    }
     template <typename F>
-    Property& operator<<=(const F& value) { return ApplyOperation([&](T& v) { v <<= static_cast<T>(value); }); }
+    Property& operator<<=(const F& value) { auto&& rhs = detail::AsOperand<T>(value); return ApplyOperation([&rhs](T& v) { v <<= rhs; }); }
     template <typename F>
-    Property& operator>>=(const F& value) { return ApplyOperation([&](T& v) { v >>= static_cast<T>(value); }); }
+    Property& operator>>=(const F& value) { auto&& rhs = detail::AsOperand<T>(value); return ApplyOperation([&rhs](T& v) { v >>= rhs; }); }
     
     // Prefix increment and decrement
-    Property& operator++() { return ApplyOperation([&](T& v) { ++v; }); }
-    Property& operator--() { return ApplyOperation([&](T& v) { --v; }); }
+    Property& operator++() {
+        if constexpr (IsAtomic && detail::HasAtomicFetch<T>) {
+            m_Value.fetch_add(1, std::memory_order_acq_rel);
+            m_Stats.OnWrite();
+            return *this;
+        }
+        return ApplyOperation([&](T& v) { ++v; });
+    }
+    Property& operator--() {
+        if constexpr (IsAtomic && detail::HasAtomicFetch<T>) {
+            m_Value.fetch_sub(1, std::memory_order_acq_rel);
+            m_Stats.OnWrite();
+            return *this;
+        }
+        return ApplyOperation([&](T& v) { --v; });
+    }
 
     // Postfix increment and decrement
-    Property& operator++(int) { return ApplyOperation([&](T& v) { T old = v; v++; return old; }); }
-    Property& operator--(int) { return ApplyOperation([&](T& v) { T old = v; v--; return old; }); }
+    Property& operator++(int) { return ++(*this); }
+    Property& operator--(int) { return --(*this); }
 
     // Arithmetic operator overloads (binary operators)
     template <typename F>
-    auto operator+(const F& value) const { return Get() + static_cast<T>(value); }
+    constexpr auto operator+(const F& value) const { auto&& rhs = detail::AsOperand<T>(value); return Read([&rhs](const T& v) { return v + rhs; }); }
     template <typename F>
-    auto operator-(const F& value) const { return Get() - static_cast<T>(value); }
+    constexpr auto operator-(const F& value) const { auto&& rhs = detail::AsOperand<T>(value); return Read([&rhs](const T& v) { return v - rhs; }); }
     template <typename F>
-    auto operator*(const F& value) const { return Get() * static_cast<T>(value); }
+    constexpr auto operator*(const F& value) const { auto&& rhs = detail::AsOperand<T>(value); return Read([&rhs](const T& v) { return v * rhs; }); }
     template <typename F>
-    auto operator/(const F& value) const { return Get() / static_cast<T>(value); }
+    constexpr auto operator/(const F& value) const { auto&& rhs = detail::AsOperand<T>(value); return Read([&rhs](const T& v) { return v / rhs; }); }
     template <typename F>
-    auto operator%(const F& value) const { return Get() % static_cast<T>(value); }
+    constexpr auto operator%(const F& value) const { auto&& rhs = detail::AsOperand<T>(value); return Read([&rhs](const T& v) { return v % rhs; }); }
 
     // Bitwise operator overloads (binary operators)
     template <typename F>
-    auto operator&(const F& value) const { return Get() & static_cast<T>(value); }
+    constexpr auto operator&(const F& value) const { auto&& rhs = detail::AsOperand<T>(value); return Read([&rhs](const T& v) { return v & rhs; }); }
     template <typename F>
-    auto operator|(const F& value) const { return Get() | static_cast<T>(value); }
+    constexpr auto operator|(const F& value) const { auto&& rhs = detail::AsOperand<T>(value); return Read([&rhs](const T& v) { return v | rhs; }); }
     template <typename F>
-    auto operator^(const F& value) const { return Get() ^ static_cast<T>(value); }
+    constexpr auto operator^(const F& value) const { auto&& rhs = detail::AsOperand<T>(value); return Read([&rhs](const T& v) { return v ^ rhs; }); }
     template <typename F>
-    auto operator<<(const F& value) const { return Get() << static_cast<T>(value); }
+    constexpr auto operator<<(const F& value) const { auto&& rhs = detail::AsOperand<T>(value); return Read([&rhs](const T& v) { return v << rhs; }); }
     template <typename F>
-    auto operator>>(const F& value) const { return Get() >> static_cast<T>(value); }
+    constexpr auto operator>>(const F& value) const { auto&& rhs = detail::AsOperand<T>(value); return Read([&rhs](const T& v) { return v >> rhs; }); }
 
     // Comparison operators
     template <typename F>
-    bool operator==(const F& value) const { return Get() == static_cast<T>(value); }
+    constexpr bool operator==(const F& value) const { auto&& rhs = detail::AsOperand<T>(value); return Read([&rhs](const T& v) { return v == rhs; }); }
     template <typename F>
-    bool operator!=(const F& value) const { return Get() != static_cast<T>(value); }
+    constexpr bool operator!=(const F& value) const { auto&& rhs = detail::AsOperand<T>(value); return Read([&rhs](const T& v) { return v != rhs; }); }
     template <typename F>
-    bool operator<(const F& value) const { return Get() < static_cast<T>(value); }
+    constexpr bool operator<(const F& value) const { auto&& rhs = detail::AsOperand<T>(value); return Read([&rhs](const T& v) { return v < rhs; }); }
     template <typename F>
-    bool operator<=(const F& value) const { return Get() <= static_cast<T>(value); }
+    constexpr bool operator<=(const F& value) const { auto&& rhs = detail::AsOperand<T>(value); return Read([&rhs](const T& v) { return v <= rhs; }); }
     template <typename F>
-    bool operator>(const F& value) const { return Get() > static_cast<T>(value); }
+    constexpr bool operator>(const F& value) const { auto&& rhs = detail::AsOperand<T>(value); return Read([&rhs](const T& v) { return v > rhs; }); }
     template <typename F>
-    bool operator>=(const F& value) const { return Get() >= static_cast<T>(value); }
+    constexpr bool operator>=(const F& value) const { auto&& rhs = detail::AsOperand<T>(value); return Read([&rhs](const T& v) { return v >= rhs; }); }
 
 protected:
-    template <typename G = GetterType, typename = std::enable_if_t<
-        std::is_same_v<G, GetterTypeValue<T>>
-    >>
-    inline T Get() {
-        if constexpr (ThreadSafe) {
-            std::lock_guard<std::recursive_mutex> lock(m_Mutex);
-        }
+    inline Reference Get() {
+        StatsGuard<ReadLock> lock(m_Mutex.Get(), m_Stats);
+        m_Stats.OnRead();
         return GetST();
     }
     
-    template <typename G = GetterType, typename = std::enable_if_t<
-        std::is_same_v<G, GetterTypeValue<T>>
-    >>
-    inline const T Get() const {
-        if constexpr (ThreadSafe) {
-            std::lock_guard<std::recursive_mutex> lock(m_Mutex);
-        }
+    constexpr ConstReference Get() const {
+        StatsGuard<ReadLock> lock(m_Mutex.Get(), m_Stats);
+        m_Stats.OnRead();
         return GetST();
     }
-    
-    template <typename G = GetterType, typename = std::enable_if_t<
-        std::is_same_v<G, GetterTypeRef<T>> || std::is_same_v<G, NoGetter>
-    >>
-    inline T& Get() {
-        if constexpr (ThreadSafe) {
-            std::lock_guard<std::recursive_mutex> lock(m_Mutex);
-        }
-        return GetST();
+
+    // Evaluates `reader` on the current value while the lock is held
+    template <typename Reader>
+    constexpr auto Read(Reader&& reader) const {
+        StatsGuard<ReadLock> lock(m_Mutex.Get(), m_Stats);
+        m_Stats.OnRead();
+        return ReadST(std::forward<Reader>(reader));
     }
-    
-    template <typename G = GetterType, typename = std::enable_if_t<
-        std::is_same_v<G, GetterTypeRef<T>> || std::is_same_v<G, NoGetter>
-    >>
-    inline const T& Get() const {
-        if constexpr (ThreadSafe) {
-            std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+
+    template <typename Reader>
+    constexpr auto ReadST(Reader&& reader) const {
+        if constexpr (IsSnapshot) {
+            auto snapshot = GetST();
+            return reader(*snapshot);
+        } else {
+            return reader(GetST());
         }
-        return GetST();
     }
 
     inline void Set(const T& newValue) {
-        if constexpr (ThreadSafe) {
-            std::lock_guard<std::recursive_mutex> lock(m_Mutex);
-        }
+        StatsGuard<std::lock_guard<Mutex>> lock(m_Mutex.Get(), m_Stats);
         SetST(newValue);
     }
 
-    inline Property& ApplyOperation(const std::function<void(T&)>& operation) {
-        if constexpr (ThreadSafe) {
-            std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+    inline void Set(T&& newValue) {
+        StatsGuard<std::lock_guard<Mutex>> lock(m_Mutex.Get(), m_Stats);
+        SetST(std::move(newValue));
+    }
+
+    // Callable is a template parameter so operators inline into the caller. Without getter and setter
+    // plain storage is modified in place, otherwise copy of the value goes through getter and setter
+    template <typename Operation>
+    inline Property& ApplyOperation(Operation&& operation) {
+        if constexpr (IsAtomic) {
+            // Compare-and-swap loop for operations that have no native atomic instruction
+            T expected = m_Value.load(std::memory_order_relaxed);
+            T desired;
+            do {
+                desired = expected;
+                operation(desired);
+            } while (!m_Value.compare_exchange_weak(expected, desired, std::memory_order_acq_rel, std::memory_order_relaxed));
+            m_Stats.OnWrite();
+            return *this;
         }
-        auto value = GetST();
-        operation(value);
-        SetST(value);
+        StatsGuard<std::lock_guard<Mutex>> lock(m_Mutex.Get(), m_Stats);
+        ApplyST(operation);
         
         return *this;
     }
-    
-    template <typename G = GetterType, typename = std::enable_if_t<
-        std::is_same_v<G, GetterTypeValue<T>>
-    >>
-    inline T GetST() {
-        if constexpr (!std::is_same_v<GetterType, NoGetter>) {
-            if (m_Getter && !m_GetterActive) {
-                GetterGuard guard(*this);
-                return m_Getter();
-            }
+
+    template <typename Operation>
+    inline void ApplyST(Operation&& operation) {
+        if constexpr (IsPlainStorage && std::is_same_v<GetterType, NoGetter> && std::is_same_v<SetterType, NoSetter>) {
+            operation(m_Value);
+            OnChangedST();
+        } else {
+            T value = CopyST();
+            operation(value);
+            SetST(std::move(value));
         }
-        return m_Value;
     }
     
-    template <typename G = GetterType, typename = std::enable_if_t<
-        std::is_same_v<G, GetterTypeValue<T>>
-    >>
-    inline const T GetST() const {
-        if constexpr (!std::is_same_v<GetterType, NoGetter>) {
-            if (m_Getter && !m_GetterActive) {
-                GetterGuard guard(*this);
-                return m_Getter();
+    inline Reference GetST() {
+        if constexpr (IsCached) {
+            RefreshCacheST();
+            return LoadValue();
+        } else if constexpr (!IsPlainStorage) {
+            return LoadValue();
+        } else {
+            if constexpr (!std::is_same_v<GetterType, NoGetter>) {
+                if (m_Getter && !m_GetterActive) {
+                    GetterGuard guard(*this);
+                    m_Stats.OnGetter();
+                    if constexpr (detail::IsFunctorGetter<GetterType>) {
+                        return m_Getter(m_Value);
+                    } else {
+                        return m_Getter();
+                    }
+                }
             }
+            return m_Value;
         }
-        return m_Value;
     }
     
-    template <typename G = GetterType, typename = std::enable_if_t<
-        std::is_same_v<G, GetterTypeRef<T>> || std::is_same_v<G, NoGetter>
-    >>
-    inline T& GetST() {
-        if constexpr (!std::is_same_v<GetterType, NoGetter>) {
-            if (m_Getter && !m_GetterActive) {
-                GetterGuard guard(*this);
-                return m_Getter();
+    constexpr ConstReference GetST() const {
+        if constexpr (IsCached) {
+            RefreshCacheST();
+            return LoadValue();
+        } else if constexpr (!IsPlainStorage) {
+            return LoadValue();
+        } else {
+            if constexpr (!std::is_same_v<GetterType, NoGetter>) {
+                if (m_Getter && !m_GetterActive) {
+                    GetterGuard guard(*this);
+                    m_Stats.OnGetter();
+                    if constexpr (detail::IsFunctorGetter<GetterType>) {
+                        return m_Getter(m_Value);
+                    } else {
+                        return m_Getter();
+                    }
+                }
             }
+            return m_Value;
         }
-        return m_Value;
     }
-    
-    template <typename G = GetterType, typename = std::enable_if_t<
-        std::is_same_v<G, GetterTypeRef<T>> || std::is_same_v<G, NoGetter>
-    >>
-    inline const T& GetST() const {
-        if constexpr (!std::is_same_v<GetterType, NoGetter>) {
-            if (m_Getter && !m_GetterActive) {
-                GetterGuard guard(*this);
-                return m_Getter();
+
+    // Recomputes stale cached getter result into the storage. Cache is marked valid before the getter runs,
+    // so invalidation that races with recomputation makes the next read recompute again.
+    // Reads of the property inside the getter return previous result
+    inline void RefreshCacheST() const {
+        if (m_Getter && !m_GetterActive && m_Getter.Validate()) {
+            GetterGuard guard(*this);
+            m_Stats.OnGetter();
+            try {
+                m_Value.Store(m_Getter());
+            } catch (...) {
+                m_Getter.Invalidate();
+                throw;
             }
         }
-        return m_Value;
     }
 
-    inline void SetST(const T& newValue) {
-        if constexpr (!std::is_same_v<SetterType, NoSetter>) {
+    // Accepts const T& or T&&, rvalue is moved into the setter argument or the storage
+    template <typename U>
+    inline void SetST(U&& newValue) {
+        static_assert(std::is_same_v<std::decay_t<U>, T>, "SetST expects value of property type");
+
+        if constexpr (detail::IsAsyncSetter<SetterType>) {
+            // Value is published right away, setter runs later on the executor with the latest value
+            if (m_Setter) {
+                m_Setter.Post(static_cast<const T&>(newValue));
+            }
+        } else if constexpr (!std::is_same_v<SetterType, NoSetter>) {
             if (m_Setter && !m_SetterActive) {
-                SetterGuard guard(*this);
-                m_Setter(newValue);
+                {
+                    SetterGuard guard(*this);
+                    m_Stats.OnSetter();
+                    if constexpr (detail::IsFunctorSetter<SetterType>) {
+                        StoreValue(m_Setter(newValue));
+                    } else {
+                        m_Setter(std::forward<U>(newValue));
+                    }
+                }
+                OnChangedST();
                 return;
             }
         } 
 
-        m_Value = newValue;
+        StoreValue(std::forward<U>(newValue));
+        OnChangedST();
+    }
+
+    // Assignments made by the setter itself are reported once, when the setter returns
+    inline void OnChangedST() {
+        if (!m_SetterActive) {
+            m_Stats.OnWrite();
+            if constexpr (!std::is_same_v<HookPolicy, NoHooks>) {
+                m_Hooks.OnChanged();
+            }
+        }
+    }
+
+    // Copy of the current value taken by read-modify-write operations
+    inline T CopyST() const {
+        if constexpr (IsSnapshot) {
+            return *GetST();
+        } else {
+            return GetST();
+        }
+    }
+
+    // Raw access to the storage, atomic, sequence lock, snapshot and buffered storage synchronize by themselves
+    inline decltype(auto) LoadValue() const {
+        if constexpr (IsAtomic) {
+            return m_Value.load(std::memory_order_acquire);
+        } else if constexpr (IsSeqLock || IsSnapshot || IsBuffered || IsCached) {
+            return m_Value.Load();
+        } else {
+            return m_Value;
+        }
+    }
+
+    // Storage contents taken by copy and move, snapshot properties share the immutable value
+    constexpr auto CopyStorage() const {
+        RawReadLock lock(m_Mutex.Get());
+        if constexpr (IsPlainStorage) {
+            return T(m_Value);
+        } else {
+            return LoadValue();
+        }
+    }
+
+    inline auto MoveStorage() {
+        std::lock_guard<Mutex> lock(m_Mutex.Get());
+        if constexpr (IsPlainStorage) {
+            return T(std::move(m_Value));
+        } else {
+            return LoadValue();
+        }
+    }
+
+    template <typename U>
+    inline void AssignStorage(U&& value) {
+        std::lock_guard<Mutex> lock(m_Mutex.Get());
+        if constexpr (IsSnapshot) {
+            m_Value.Store(std::forward<U>(value));
+        } else {
+            StoreValue(std::forward<U>(value));
+        }
+        OnChangedST();
+    }
+
+    template <typename U>
+    inline void StoreValue(U&& newValue) {
+        if constexpr (IsAtomic) {
+            m_Value.store(newValue, std::memory_order_release);
+        } else if constexpr (IsSeqLock) {
+            m_Value.Store(newValue);
+        } else if constexpr (IsSnapshot) {
+            m_Value.Store(std::make_shared<const T>(std::forward<U>(newValue)));
+        } else if constexpr (IsBuffered || IsCached) {
+            m_Value.Store(std::forward<U>(newValue));
+        } else {
+            m_Value = std::forward<U>(newValue);
+        }
     }
 
 private:
+    friend struct detail::PropertyAccess;
+    friend typename detail::RelativeBindingOwner<GetterType>::type;
+    friend typename detail::RelativeBindingOwner<SetterType>::type;
+
+    // Copy and move of property with relative getter or setter, available to the owner only
+    constexpr Property(std::conditional_t<IsRelocatable && IsOwnerRelocated, const Property&, const detail::DisabledCopy<2>&> other)
+        : Property(other, detail::RelocateTag{})
+    {
+    }
+
+    Property(std::conditional_t<IsRelocatable && IsOwnerRelocated, Property&&, detail::DisabledCopy<2>&&> other) noexcept(std::is_nothrow_move_constructible_v<T>)
+        : Property(std::move(other), detail::RelocateTag{})
+    {
+    }
+
+    Property& operator=(std::conditional_t<IsAssignable && IsOwnerRelocated, const Property&, const detail::DisabledCopy<2>&> other) {
+        return CopyAssign(other);
+    }
+
+    Property& operator=(std::conditional_t<IsAssignable && IsOwnerRelocated, Property&&, detail::DisabledCopy<2>&&> other) {
+        return MoveAssign(std::move(other));
+    }
+
+    // Relative getters and setters keep their offsets, so they call the owner that holds the new property
+    constexpr Property(const Property& other, detail::RelocateTag)
+        : m_Value(other.CopyStorage())
+        , m_Getter(other.m_Getter)
+        , m_Setter(other.m_Setter)
+    {
+    }
+
+    Property(Property&& other, detail::RelocateTag) noexcept(std::is_nothrow_move_constructible_v<T>)
+        : m_Value(other.MoveStorage())
+        , m_Getter(std::move(other.m_Getter))
+        , m_Setter(std::move(other.m_Setter))
+    {
+    }
+
+    Property& CopyAssign(const Property& other) {
+        if (this != &other) {
+            AssignStorage(other.CopyStorage());
+        }
+        return *this;
+    }
+
+    Property& MoveAssign(Property&& other) {
+        if (this != &other) {
+            AssignStorage(other.MoveStorage());
+        }
+        return *this;
+    }
+
     // Helper classe to guard the setter
     class SetterGuard {
     public:
@@ -435,15 +1488,67 @@ private:
         const Property& m_Property;
     };
 
-    T m_Value;
-    mutable std::recursive_mutex m_Mutex;
+    // Flags are kept next to the value so they fit into its padding. Padded policy aligns the value,
+    // so the property starts a cache line and its size is rounded up to whole lines
+    static constexpr std::size_t ValueAlignment = detail::LockTraits<LockPolicy>::Alignment > alignof(Storage)
+        ? detail::LockTraits<LockPolicy>::Alignment : alignof(Storage);
+
+    alignas(ValueAlignment) Storage m_Value;
+    PROPP_NO_UNIQUE_ADDRESS detail::ActiveFlag<!std::is_same_v<SetterType, NoSetter>, NoSetter> m_SetterActive;
+    PROPP_NO_UNIQUE_ADDRESS detail::ActiveFlag<!std::is_same_v<GetterType, NoGetter>, NoGetter> m_GetterActive;
+    PROPP_NO_UNIQUE_ADDRESS detail::MutableSlot<Mutex> m_Mutex;
+
+    PROPP_NO_UNIQUE_ADDRESS Getter m_Getter;
+    PROPP_NO_UNIQUE_ADDRESS Setter m_Setter;
+    PROPP_NO_UNIQUE_ADDRESS HookPolicy m_Hooks;
+    PROPP_NO_UNIQUE_ADDRESS Stats m_Stats;
+};
+
+namespace detail {
+
+struct PropertyAccess {
+    template <typename P>
+    static auto& GetMutex(P& property) { return property.m_Mutex.Get(); }
+
+    template <typename P>
+    static auto& GetHooks(P& property) { return property.m_Hooks; }
 
-    Getter m_Getter;
-    Setter m_Setter;
-    mutable bool m_SetterActive;
-    mutable bool m_GetterActive;
+    template <typename P>
+    static auto& GetGetter(P& property) { return property.m_Getter; }
+
+    // Extra arguments are passed through, e.g. row index of PropertyColumn
+    template <typename P, typename... Args>
+    static decltype(auto) GetST(P& property, Args&&... args) { return property.GetST(std::forward<Args>(args)...); }
+
+    template <typename P, typename... Args>
+    static void SetST(P& property, Args&&... args) { property.SetST(std::forward<Args>(args)...); }
+
+    template <typename P, typename... Args>
+    static void ApplyST(P& property, Args&&... args) { property.ApplyST(std::forward<Args>(args)...); }
+
+    // Evaluates `reader` on the value under the read lock, ReadST expects the lock to be held by the caller
+    template <typename P, typename Reader>
+    static auto Read(const P& property, Reader&& reader) { return property.Read(std::forward<Reader>(reader)); }
+
+    template <typename P, typename Reader>
+    static auto ReadST(const P& property, Reader&& reader) { return property.ReadST(std::forward<Reader>(reader)); }
+
+    // Storage without getter and setter, e.g. for serialization in Reflect.hpp. Caller holds the lock
+    template <typename P>
+    static auto& GetStorage(P& property) { return property.m_Value; }
+
+    template <typename P>
+    static auto LoadValue(const P& property) { return property.LoadValue(); }
+
+    template <typename P, typename U>
+    static void StoreValue(P& property, U&& value) { property.StoreValue(std::forward<U>(value)); }
+
+    template <typename P>
+    static void OnChangedST(P& property) { property.OnChangedST(); }
 };
 
+} // namespace detail
+
 // Read-write property, single-threaded, no getter or setter
 template <typename T>
 using PropertyRW = Property<T, false, false, NoGetter, NoSetter>;
@@ -461,19 +1566,19 @@ template <typename T, typename GetterType = GetterTypeValue<T>, typename SetterT
 using PropertyRWGS = Property<T, false, false, GetterType, SetterType>;
 
 
-// Read-write property, single-threaded, no getter or setter
+// Read-write property, multi-threaded, no getter or setter
 template <typename T>
 using PropertyRWMT = Property<T, false, true, NoGetter, NoSetter>;
 
-// Read-write property, single-threaded, with getter
+// Read-write property, multi-threaded, with getter
 template <typename T, typename GetterType = GetterTypeValue<T>>
 using PropertyRWGMT = Property<T, false, true, GetterType, NoSetter>;
 
-// Read-write property, single-threaded, with setter
+// Read-write property, multi-threaded, with setter
 template <typename T, typename SetterType = SetterTypeValue<T>>
 using PropertyRWSMT = Property<T, false, true, NoGetter, SetterType>;
 
-// Read-write property, single-threaded, with getter and setter
+// Read-write property, multi-threaded, with getter and setter
 template <typename T, typename GetterType = GetterTypeValue<T>, typename SetterType = SetterTypeValue<T>>
 using PropertyRWGSMT = Property<T, false, true, GetterType, SetterType>;
 
@@ -511,4 +1616,76 @@ using PropertyROSMT = Property<T, true, true, NoGetter, SetterType>;
 template <typename T, typename GetterType = GetterTypeValue<T>, typename SetterType = SetterTypeValue<T>>
 using PropertyROGSMT = Property<T, true, true, GetterType, SetterType>;
 
+
+// Read-write property, multi-threaded, lock-free atomic storage
+template <typename T>
+using PropertyRWAtomic = Property<T, false, true, NoGetter, NoSetter, LockFree>;
+
+// Read-only property, multi-threaded, lock-free atomic storage
+template <typename T>
+using PropertyROAtomic = Property<T, true, true, NoGetter, NoSetter, LockFree>;
+
+// Read-write property, multi-threaded, no getter or setter, readers don't block each other
+template <typename T>
+using PropertyRWSharedMT = Property<T, false, true, NoGetter, NoSetter, SharedLock>;
+
+// Read-only property, multi-threaded, no getter or setter, readers don't block each other
+template <typename T>
+using PropertyROSharedMT = Property<T, true, true, NoGetter, NoSetter, SharedLock>;
+
+// Read-write property, multi-threaded, sequence lock storage for small trivially copyable values
+template <typename T, typename SetterType = NoSetter>
+using PropertyRWSeqLock = Property<T, false, true, NoGetter, SetterType, SeqLock>;
+
+// Read-only property, multi-threaded, sequence lock storage for small trivially copyable values
+template <typename T, typename SetterType = NoSetter>
+using PropertyROSeqLock = Property<T, true, true, NoGetter, SetterType, SeqLock>;
+
+// Read-write property, multi-threaded, readers take std::shared_ptr<const T> snapshot without locking.
+// Writes copy the value, modify it and publish the copy, for large values that are rarely written
+template <typename T, typename SetterType = NoSetter>
+using PropertyRWSnapshot = Property<T, false, true, NoGetter, SetterType, Snapshot>;
+
+// Read-only property, multi-threaded, readers take std::shared_ptr<const T> snapshot without locking
+template <typename T, typename SetterType = NoSetter>
+using PropertyROSnapshot = Property<T, true, true, NoGetter, SetterType, Snapshot>;
+
+// Read-write property, multi-threaded, single writer publishes to one of two buffers, readers get const T&
+// to the latest one without waiting. T must be trivially copyable. Reader must be done with the reference
+// before the next write, e.g. frame data read within a tick, Version() tells whether a write happened since
+// the read. Using the reference later is a data race
+template <typename T, typename SetterType = NoSetter>
+using PropertyDoubleBuffered = Property<T, false, true, NoGetter, SetterType, Buffered<2>>;
+
+// Read-write property, multi-threaded, single writer publishes to one of three buffers, readers get const T&
+// to the latest one without waiting. T must be trivially copyable. Reader must be done with the reference
+// before the write after the next one, Version() growing by 2 since the read means it was overwritten.
+// Using the reference later is a data race
+template <typename T, typename SetterType = NoSetter>
+using PropertyTripleBuffered = Property<T, false, true, NoGetter, SetterType, Buffered<3>>;
+
+// Read-write property, multi-threaded, no getter or setter, occupies whole cache lines
+template <typename T>
+using PropertyRWMTPadded = Property<T, false, true, NoGetter, NoSetter, Padded<RecursiveLock>>;
+
+// Read-only property, multi-threaded, no getter or setter, occupies whole cache lines
+template <typename T>
+using PropertyROMTPadded = Property<T, true, true, NoGetter, NoSetter, Padded<RecursiveLock>>;
+
+// Read-write property, multi-threaded, lock-free atomic storage, occupies whole cache lines
+template <typename T>
+using PropertyRWAtomicPadded = Property<T, false, true, NoGetter, NoSetter, Padded<LockFree>>;
+
+// Read-write property, single-threaded, occupies whole cache lines, e.g. per-thread statistics
+template <typename T>
+using PropertyRWPadded = Property<T, false, false, NoGetter, NoSetter, Padded<NoLock>>;
+
+// Same property with another lock policy, e.g. WithLock<PropertyRWGSMT<int>, SharedLock>
+template <typename P, typename LockPolicy>
+using WithLock = typename P::template RebindLock<LockPolicy>;
+
+// Same property with another hook policy, e.g. WithHooks<PropertyRWMT<int>, Observable>
+template <typename P, typename HookPolicy>
+using WithHooks = typename P::template RebindHooks<HookPolicy>;
+
 } // namespace propp
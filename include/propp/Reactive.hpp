@@ -0,0 +1,164 @@
+#pragma once
+
+#include "propp/Cached.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace propp {
+
+namespace detail {
+
+// Vertex of the reactive graph. Invariant: downstream of a stale node is stale, so marking stops at
+// nodes that are already stale and each write touches only the part of the graph it affects once
+class ReactiveNode {
+public:
+    explicit ReactiveNode(bool stale) : m_Stale(stale) {}
+
+    // Edges point to nodes, copy is a new unlinked node
+    ReactiveNode(const ReactiveNode&) : m_Stale(true) {}
+    ReactiveNode& operator=(const ReactiveNode&) = delete;
+
+    ~ReactiveNode() {
+        for (ReactiveNode* upstream : m_Upstream) {
+            Erase(upstream->m_Downstream, this);
+        }
+        for (ReactiveNode* downstream : m_Downstream) {
+            Erase(downstream->m_Upstream, this);
+        }
+    }
+
+    void Link(ReactiveNode& downstream) {
+        if (std::find(m_Downstream.begin(), m_Downstream.end(), &downstream) == m_Downstream.end()) {
+            m_Downstream.push_back(&downstream);
+            downstream.m_Upstream.push_back(this);
+        }
+    }
+
+    void MarkStale() {
+        if (!m_Stale.exchange(true, std::memory_order_acq_rel)) {
+            MarkDownstreamStale();
+        }
+    }
+
+    // Iterative so long chains don't exhaust the stack. Repeated writes find direct downstream already
+    // stale and don't allocate
+    void MarkDownstreamStale() {
+        std::vector<ReactiveNode*> pending;
+        for (ReactiveNode* node : m_Downstream) {
+            if (!node->m_Stale.exchange(true, std::memory_order_acq_rel)) {
+                pending.insert(pending.end(), node->m_Downstream.begin(), node->m_Downstream.end());
+            }
+        }
+        while (!pending.empty()) {
+            ReactiveNode* node = pending.back();
+            pending.pop_back();
+            if (!node->m_Stale.exchange(true, std::memory_order_acq_rel)) {
+                pending.insert(pending.end(), node->m_Downstream.begin(), node->m_Downstream.end());
+            }
+        }
+    }
+
+    // Marks node valid, returns true if it was stale and has to be recomputed
+    bool Validate() { return m_Stale.exchange(false, std::memory_order_acq_rel); }
+
+    bool IsStale() const { return m_Stale.load(std::memory_order_acquire); }
+
+private:
+    static void Erase(std::vector<ReactiveNode*>& nodes, ReactiveNode* node) {
+        nodes.erase(std::remove(nodes.begin(), nodes.end(), node), nodes.end());
+    }
+
+    std::atomic<bool> m_Stale;
+    std::vector<ReactiveNode*> m_Upstream;
+    std::vector<ReactiveNode*> m_Downstream;
+};
+
+} // namespace detail
+
+// Hook policy of reactive graph inputs, every write marks dependent computed properties stale
+class ReactiveSource {
+public:
+    void OnChanged() { m_Node.MarkDownstreamStale(); }
+
+    detail::ReactiveNode& Node() { return m_Node; }
+
+private:
+    detail::ReactiveNode m_Node{false};
+};
+
+// Getter of computed property in reactive graph. Like GetterTypeCached the result is cached in the property,
+// inputs declared with DependsOn() are Reactive properties or other computed properties. Input write marks
+// only affected computed properties stale, nothing is recomputed until read. Read recomputes stale inputs
+// first, so every computed property is evaluated at most once per change and never sees a mix of old and
+// new input values
+template <typename T>
+class GetterTypeReactive {
+public:
+    GetterTypeReactive() = default;
+
+    template <typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, GetterTypeReactive>>>
+    GetterTypeReactive(F&& compute) : m_Compute(std::forward<F>(compute)) {}
+
+    GetterTypeReactive(const GetterTypeReactive& other) : m_Compute(other.m_Compute) {}
+    GetterTypeReactive& operator=(const GetterTypeReactive& other) {
+        m_Compute = other.m_Compute;
+        Invalidate();
+        return *this;
+    }
+
+    explicit operator bool() const { return static_cast<bool>(m_Compute); }
+    T operator()() const { return m_Compute(); }
+
+    void Invalidate() const { m_Node.MarkStale(); }
+    bool Validate() const { return m_Node.Validate(); }
+    bool IsStale() const { return m_Node.IsStale(); }
+
+    detail::ReactiveNode& Node() { return m_Node; }
+
+    // Graph must be built before its properties are used by several threads
+    template <typename Dependency>
+    void AddDependency(Dependency& dependency) {
+        using Getter = typename Dependency::Getter;
+        using Hooks = typename Dependency::Hooks;
+        if constexpr (std::is_same_v<Getter, GetterTypeReactive<typename Dependency::ValueType>>) {
+            detail::PropertyAccess::GetGetter(dependency).Node().Link(m_Node);
+        } else {
+            static_assert(std::is_base_of_v<ReactiveSource, Hooks>, "Dependency must be Reactive or computed property");
+            std::lock_guard<typename Dependency::Mutex> lock(detail::PropertyAccess::GetMutex(dependency));
+            static_cast<ReactiveSource&>(detail::PropertyAccess::GetHooks(dependency)).Node().Link(m_Node);
+        }
+    }
+
+private:
+    std::function<T()> m_Compute;
+    mutable detail::ReactiveNode m_Node{true};
+};
+
+namespace detail {
+
+template <typename T>
+inline constexpr bool IsCachedGetter<GetterTypeReactive<T>> = true;
+
+template <typename T>
+struct IsGetterType<GetterTypeReactive<T>, T> : std::true_type {};
+
+} // namespace detail
+
+// Input of reactive graph, e.g. Reactive<PropertyRW<float>>
+template <typename P>
+using Reactive = WithHooks<P, ReactiveSource>;
+
+// Computed property in reactive graph, single-threaded, result is returned by const reference
+template <typename T>
+using PropertyComputed = Property<T, true, false, GetterTypeReactive<T>, NoSetter>;
+
+// Computed property in reactive graph, multi-threaded, result is returned by value copied under the lock
+template <typename T>
+using PropertyComputedMT = Property<T, true, true, GetterTypeReactive<T>, NoSetter>;
+
+} // namespace propp
@@ -0,0 +1,316 @@
+#pragma once
+
+#include "propp/Property.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Declares fields of `Type` for reflection and serialization, e.g. PROPP_REFLECT(Person, Name, Age, Address).
+// Must be placed in the namespace of `Type` after its definition, fields must be accessible there.
+// Fields may be properties, reflected types or plain values, up to 32 per type
+#define PROPP_REFLECT(Type, ...) \
+    constexpr auto PropertyFields(::propp::detail::ReflectTag<Type>) { \
+        return ::std::make_tuple(PROPP_DETAIL_EXPAND(PROPP_DETAIL_CAT(PROPP_DETAIL_FIELDS_, PROPP_DETAIL_COUNT(__VA_ARGS__))(Type, __VA_ARGS__))); \
+    }
+
+// Extra expansion makes MSVC split __VA_ARGS__ into separate arguments
+#define PROPP_DETAIL_EXPAND(x) x
+#define PROPP_DETAIL_CAT(a, b) PROPP_DETAIL_CAT_I(a, b)
+#define PROPP_DETAIL_CAT_I(a, b) a##b
+#define PROPP_DETAIL_FIELDS_1(Type, a) ::propp::MakeField(#a, &Type::a)
+#define PROPP_DETAIL_FIELDS_2(Type, a, ...) ::propp::MakeField(#a, &Type::a), PROPP_DETAIL_EXPAND(PROPP_DETAIL_FIELDS_1(Type, __VA_ARGS__))
+#define PROPP_DETAIL_FIELDS_3(Type, a, ...) ::propp::MakeField(#a, &Type::a), PROPP_DETAIL_EXPAND(PROPP_DETAIL_FIELDS_2(Type, __VA_ARGS__))
+#define PROPP_DETAIL_FIELDS_4(Type, a, ...) ::propp::MakeField(#a, &Type::a), PROPP_DETAIL_EXPAND(PROPP_DETAIL_FIELDS_3(Type, __VA_ARGS__))
+#define PROPP_DETAIL_FIELDS_5(Type, a, ...) ::propp::MakeField(#a, &Type::a), PROPP_DETAIL_EXPAND(PROPP_DETAIL_FIELDS_4(Type, __VA_ARGS__))
+#define PROPP_DETAIL_FIELDS_6(Type, a, ...) ::propp::MakeField(#a, &Type::a), PROPP_DETAIL_EXPAND(PROPP_DETAIL_FIELDS_5(Type, __VA_ARGS__))
+#define PROPP_DETAIL_FIELDS_7(Type, a, ...) ::propp::MakeField(#a, &Type::a), PROPP_DETAIL_EXPAND(PROPP_DETAIL_FIELDS_6(Type, __VA_ARGS__))
+#define PROPP_DETAIL_FIELDS_8(Type, a, ...) ::propp::MakeField(#a, &Type::a), PROPP_DETAIL_EXPAND(PROPP_DETAIL_FIELDS_7(Type, __VA_ARGS__))
+#define PROPP_DETAIL_FIELDS_9(Type, a, ...) ::propp::MakeField(#a, &Type::a), PROPP_DETAIL_EXPAND(PROPP_DETAIL_FIELDS_8(Type, __VA_ARGS__))
+#define PROPP_DETAIL_FIELDS_10(Type, a, ...) ::propp::MakeField(#a, &Type::a), PROPP_DETAIL_EXPAND(PROPP_DETAIL_FIELDS_9(Type, __VA_ARGS__))
+#define PROPP_DETAIL_FIELDS_11(Type, a, ...) ::propp::MakeField(#a, &Type::a), PROPP_DETAIL_EXPAND(PROPP_DETAIL_FIELDS_10(Type, __VA_ARGS__))
+#define PROPP_DETAIL_FIELDS_12(Type, a, ...) ::propp::MakeField(#a, &Type::a), PROPP_DETAIL_EXPAND(PROPP_DETAIL_FIELDS_11(Type, __VA_ARGS__))
+#define PROPP_DETAIL_FIELDS_13(Type, a, ...) ::propp::MakeField(#a, &Type::a), PROPP_DETAIL_EXPAND(PROPP_DETAIL_FIELDS_12(Type, __VA_ARGS__))
+#define PROPP_DETAIL_FIELDS_14(Type, a, ...) ::propp::MakeField(#a, &Type::a), PROPP_DETAIL_EXPAND(PROPP_DETAIL_FIELDS_13(Type, __VA_ARGS__))
+#define PROPP_DETAIL_FIELDS_15(Type, a, ...) ::propp::MakeField(#a, &Type::a), PROPP_DETAIL_EXPAND(PROPP_DETAIL_FIELDS_14(Type, __VA_ARGS__))
+#define PROPP_DETAIL_FIELDS_16(Type, a, ...) ::propp::MakeField(#a, &Type::a), PROPP_DETAIL_EXPAND(PROPP_DETAIL_FIELDS_15(Type, __VA_ARGS__))
+#define PROPP_DETAIL_FIELDS_17(Type, a, ...) ::propp::MakeField(#a, &Type::a), PROPP_DETAIL_EXPAND(PROPP_DETAIL_FIELDS_16(Type, __VA_ARGS__))
+#define PROPP_DETAIL_FIELDS_18(Type, a, ...) ::propp::MakeField(#a, &Type::a), PROPP_DETAIL_EXPAND(PROPP_DETAIL_FIELDS_17(Type, __VA_ARGS__))
+#define PROPP_DETAIL_FIELDS_19(Type, a, ...) ::propp::MakeField(#a, &Type::a), PROPP_DETAIL_EXPAND(PROPP_DETAIL_FIELDS_18(Type, __VA_ARGS__))
+#define PROPP_DETAIL_FIELDS_20(Type, a, ...) ::propp::MakeField(#a, &Type::a), PROPP_DETAIL_EXPAND(PROPP_DETAIL_FIELDS_19(Type, __VA_ARGS__))
+#define PROPP_DETAIL_FIELDS_21(Type, a, ...) ::propp::MakeField(#a, &Type::a), PROPP_DETAIL_EXPAND(PROPP_DETAIL_FIELDS_20(Type, __VA_ARGS__))
+#define PROPP_DETAIL_FIELDS_22(Type, a, ...) ::propp::MakeField(#a, &Type::a), PROPP_DETAIL_EXPAND(PROPP_DETAIL_FIELDS_21(Type, __VA_ARGS__))
+#define PROPP_DETAIL_FIELDS_23(Type, a, ...) ::propp::MakeField(#a, &Type::a), PROPP_DETAIL_EXPAND(PROPP_DETAIL_FIELDS_22(Type, __VA_ARGS__))
+#define PROPP_DETAIL_FIELDS_24(Type, a, ...) ::propp::MakeField(#a, &Type::a), PROPP_DETAIL_EXPAND(PROPP_DETAIL_FIELDS_23(Type, __VA_ARGS__))
+#define PROPP_DETAIL_FIELDS_25(Type, a, ...) ::propp::MakeField(#a, &Type::a), PROPP_DETAIL_EXPAND(PROPP_DETAIL_FIELDS_24(Type, __VA_ARGS__))
+#define PROPP_DETAIL_FIELDS_26(Type, a, ...) ::propp::MakeField(#a, &Type::a), PROPP_DETAIL_EXPAND(PROPP_DETAIL_FIELDS_25(Type, __VA_ARGS__))
+#define PROPP_DETAIL_FIELDS_27(Type, a, ...) ::propp::MakeField(#a, &Type::a), PROPP_DETAIL_EXPAND(PROPP_DETAIL_FIELDS_26(Type, __VA_ARGS__))
+#define PROPP_DETAIL_FIELDS_28(Type, a, ...) ::propp::MakeField(#a, &Type::a), PROPP_DETAIL_EXPAND(PROPP_DETAIL_FIELDS_27(Type, __VA_ARGS__))
+#define PROPP_DETAIL_FIELDS_29(Type, a, ...) ::propp::MakeField(#a, &Type::a), PROPP_DETAIL_EXPAND(PROPP_DETAIL_FIELDS_28(Type, __VA_ARGS__))
+#define PROPP_DETAIL_FIELDS_30(Type, a, ...) ::propp::MakeField(#a, &Type::a), PROPP_DETAIL_EXPAND(PROPP_DETAIL_FIELDS_29(Type, __VA_ARGS__))
+#define PROPP_DETAIL_FIELDS_31(Type, a, ...) ::propp::MakeField(#a, &Type::a), PROPP_DETAIL_EXPAND(PROPP_DETAIL_FIELDS_30(Type, __VA_ARGS__))
+#define PROPP_DETAIL_FIELDS_32(Type, a, ...) ::propp::MakeField(#a, &Type::a), PROPP_DETAIL_EXPAND(PROPP_DETAIL_FIELDS_31(Type, __VA_ARGS__))
+#define PROPP_DETAIL_COUNT_N(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, N, ...) N
+#define PROPP_DETAIL_COUNT(...) PROPP_DETAIL_EXPAND(PROPP_DETAIL_COUNT_N(__VA_ARGS__, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0))
+
+namespace propp {
+
+// Reflected field, pointer to member `Member` of `Class`
+template <typename Class, typename Member>
+struct Field {
+    using ClassType = Class;
+    using MemberType = Member;
+
+    const char* Name;
+    Member Class::* Pointer;
+};
+
+template <typename Class, typename Member>
+constexpr Field<Class, Member> MakeField(const char* name, Member Class::* pointer) {
+    return Field<Class, Member>{ name, pointer };
+}
+
+namespace detail {
+
+// Argument of PropertyFields() generated by PROPP_REFLECT, found by argument-dependent lookup
+template <typename T>
+struct ReflectTag {};
+
+template <typename T, typename = void>
+struct IsReflected : std::false_type {};
+
+template <typename T>
+struct IsReflected<T, std::void_t<decltype(PropertyFields(ReflectTag<T>{}))>> : std::true_type {};
+
+template <typename T>
+struct IsProperty : std::false_type {};
+
+template <typename T, bool ReadOnly, bool ThreadSafe, typename G, typename S, typename L, typename H>
+struct IsProperty<Property<T, ReadOnly, ThreadSafe, G, S, L, H>> : std::true_type {};
+
+template <typename T>
+struct IsString : std::false_type {};
+
+template <typename C, typename Traits, typename Allocator>
+struct IsString<std::basic_string<C, Traits, Allocator>> : std::true_type {};
+
+template <typename T>
+struct IsVector : std::false_type {};
+
+template <typename E, typename Allocator>
+struct IsVector<std::vector<E, Allocator>> : std::true_type {};
+
+template <typename T>
+inline constexpr bool AlwaysFalse = false;
+
+} // namespace detail
+
+template <typename T>
+inline constexpr bool IsReflected = detail::IsReflected<T>::value;
+
+// Constexpr tuple of Field declared by PROPP_REFLECT for `T`, in declaration order
+template <typename T>
+inline constexpr auto Fields = PropertyFields(detail::ReflectTag<T>{});
+
+template <typename T>
+inline constexpr std::size_t FieldCount = std::tuple_size_v<std::decay_t<decltype(Fields<T>)>>;
+
+// Calls `visitor(name, member)` for every reflected field of `object`, members are properties themselves
+template <typename Object, typename Visitor>
+void ForEachField(Object& object, Visitor&& visitor) {
+    std::apply([&](const auto&... fields) { (visitor(fields.Name, object.*(fields.Pointer)), ...); },
+        Fields<std::remove_const_t<Object>>);
+}
+
+// Appends binary representation of values to the buffer. Trivially copyable values are copied as is,
+// strings and vectors are prefixed with 64-bit element count, reflected types are written field by field.
+// Properties are written from their storage under the property lock, getters aren't invoked.
+// Values are kept in byte order and layout of the target, data isn't portable across architectures
+class BinaryWriter {
+public:
+    explicit BinaryWriter(std::vector<std::uint8_t>& buffer) : m_Buffer(buffer) {}
+
+    void WriteBytes(const void* data, std::size_t size) {
+        const auto* bytes = static_cast<const std::uint8_t*>(data);
+        m_Buffer.insert(m_Buffer.end(), bytes, bytes + size);
+    }
+
+    template <typename T>
+    void Write(const T& value) {
+        if constexpr (detail::IsProperty<T>::value) {
+            WriteProperty(value);
+        } else if constexpr (std::is_trivially_copyable_v<T>) {
+            WriteBytes(&value, sizeof(T));
+        } else if constexpr (detail::IsString<T>::value) {
+            WriteSize(value.size());
+            WriteBytes(value.data(), value.size() * sizeof(typename T::value_type));
+        } else if constexpr (detail::IsVector<T>::value) {
+            using Element = typename T::value_type;
+            static_assert(!std::is_same_v<Element, bool>, "std::vector<bool> isn't serializable");
+            WriteSize(value.size());
+            if constexpr (std::is_trivially_copyable_v<Element>) {
+                WriteBytes(value.data(), value.size() * sizeof(Element));
+            } else {
+                for (const Element& element : value) {
+                    Write(element);
+                }
+            }
+        } else if constexpr (IsReflected<T>) {
+            ForEachField(value, [this](const char*, const auto& member) { Write(member); });
+        } else {
+            static_assert(detail::AlwaysFalse<T>, "Type isn't serializable, declare its fields with PROPP_REFLECT");
+        }
+    }
+
+private:
+    void WriteSize(std::size_t size) {
+        const auto count = static_cast<std::uint64_t>(size);
+        WriteBytes(&count, sizeof(count));
+    }
+
+    template <typename P>
+    void WriteProperty(const P& property) {
+        static_assert(!detail::IsCachedGetter<typename P::Getter>, "Computed properties are derived from other properties and aren't serialized");
+        typename P::RawReadLock lock(detail::PropertyAccess::GetMutex(property));
+        if constexpr (P::IsPlainStorage) {
+            Write(detail::PropertyAccess::GetStorage(property));
+        } else if constexpr (P::IsSnapshot) {
+            Write(*detail::PropertyAccess::LoadValue(property));
+        } else {
+            Write(detail::PropertyAccess::LoadValue(property));
+        }
+    }
+
+    std::vector<std::uint8_t>& m_Buffer;
+};
+
+// Reads values written by BinaryWriter. Truncated or malformed input makes the reader fail, every
+// following read returns false. Values read before the failure stay assigned.
+// Properties are assigned without invoking setters, including read-only ones, hooks are notified
+class BinaryReader {
+public:
+    BinaryReader(const void* data, std::size_t size)
+        : m_Data(static_cast<const std::uint8_t*>(data))
+        , m_Size(size)
+    {
+    }
+
+    bool Ok() const { return m_Ok; }
+    std::size_t Remaining() const { return m_Size - m_Offset; }
+
+    bool ReadBytes(void* data, std::size_t size) {
+        if (!m_Ok || size > Remaining()) {
+            m_Ok = false;
+            return false;
+        }
+        if (size > 0) {
+            std::memcpy(data, m_Data + m_Offset, size);
+        }
+        m_Offset += size;
+        return true;
+    }
+
+    template <typename T>
+    bool Read(T& value) {
+        if constexpr (detail::IsProperty<T>::value) {
+            ReadProperty(value);
+        } else if constexpr (std::is_trivially_copyable_v<T>) {
+            ReadBytes(&value, sizeof(T));
+        } else if constexpr (detail::IsString<T>::value) {
+            using Char = typename T::value_type;
+            std::size_t size = 0;
+            if (ReadSize(size, sizeof(Char))) {
+                value.resize(size);
+                ReadBytes(&value[0], size * sizeof(Char));
+            }
+        } else if constexpr (detail::IsVector<T>::value) {
+            using Element = typename T::value_type;
+            static_assert(!std::is_same_v<Element, bool>, "std::vector<bool> isn't serializable");
+            std::size_t size = 0;
+            if constexpr (std::is_trivially_copyable_v<Element>) {
+                if (ReadSize(size, sizeof(Element))) {
+                    value.resize(size);
+                    ReadBytes(value.data(), size * sizeof(Element));
+                }
+            } else if (ReadSize(size, 1)) {
+                value.resize(size);
+                for (std::size_t i = 0; i < size && Read(value[i]); ++i) {
+                }
+            }
+        } else if constexpr (IsReflected<T>) {
+            ForEachField(value, [this](const char*, auto& member) {
+                if (m_Ok) {
+                    Read(member);
+                }
+            });
+        } else {
+            static_assert(detail::AlwaysFalse<T>, "Type isn't serializable, declare its fields with PROPP_REFLECT");
+        }
+        return m_Ok;
+    }
+
+private:
+    // Count is checked against remaining input before anything is allocated
+    bool ReadSize(std::size_t& size, std::size_t minElementSize) {
+        std::uint64_t count = 0;
+        if (!ReadBytes(&count, sizeof(count))) {
+            return false;
+        }
+        if (count > Remaining() / minElementSize) {
+            m_Ok = false;
+            return false;
+        }
+        size = static_cast<std::size_t>(count);
+        return true;
+    }
+
+    template <typename P>
+    void ReadProperty(P& property) {
+        static_assert(!detail::IsCachedGetter<typename P::Getter>, "Computed properties are derived from other properties and aren't serialized");
+        using T = typename P::ValueType;
+        std::lock_guard<typename P::Mutex> lock(detail::PropertyAccess::GetMutex(property));
+        if constexpr (P::IsPlainStorage) {
+            if (!Read(detail::PropertyAccess::GetStorage(property))) {
+                return;
+            }
+        } else {
+            T value{};
+            if (!Read(value)) {
+                return;
+            }
+            detail::PropertyAccess::StoreValue(property, std::move(value));
+        }
+        detail::PropertyAccess::OnChangedST(property);
+    }
+
+    const std::uint8_t* m_Data;
+    std::size_t m_Size;
+    std::size_t m_Offset = 0;
+    bool m_Ok = true;
+};
+
+// Binary representation of reflected object, see BinaryWriter
+template <typename Object>
+std::vector<std::uint8_t> Serialize(const Object& object) {
+    std::vector<std::uint8_t> buffer;
+    BinaryWriter(buffer).Write(object);
+    return buffer;
+}
+
+// Assigns object from data produced by Serialize, returns false if data is truncated or has extra bytes
+template <typename Object>
+bool Deserialize(Object& object, const void* data, std::size_t size) {
+    BinaryReader reader(data, size);
+    return reader.Read(object) && reader.Remaining() == 0;
+}
+
+template <typename Object>
+bool Deserialize(Object& object, const std::vector<std::uint8_t>& buffer) {
+    return Deserialize(object, buffer.data(), buffer.size());
+}
+
+} // namespace propp
@@ -0,0 +1,274 @@
+#pragma once
+
+// Access statistics of properties, enabled by defining PROPP_ENABLE_STATS to 1 for the whole program.
+// Disabled statistics are empty members with inline no-op methods and take no space in properties.
+// Included by Property.hpp
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#ifndef PROPP_ENABLE_STATS
+#define PROPP_ENABLE_STATS 0
+#endif
+
+namespace propp {
+
+// Counters of one property or of all properties sharing a name
+struct PropertyStatsRecord {
+    std::string Name;
+    std::uint64_t Reads = 0;
+    std::uint64_t Writes = 0;
+    std::uint64_t GetterCalls = 0;
+    std::uint64_t SetterCalls = 0;
+    std::uint64_t Contended = 0;         // lock acquisitions that had to wait
+    std::uint64_t WaitNanoseconds = 0;   // total time spent waiting for the lock
+};
+
+namespace detail {
+
+struct StatsEntry {
+    std::string m_Name;
+    std::atomic<std::uint64_t> m_Reads{0};
+    std::atomic<std::uint64_t> m_Writes{0};
+    std::atomic<std::uint64_t> m_GetterCalls{0};
+    std::atomic<std::uint64_t> m_SetterCalls{0};
+    std::atomic<std::uint64_t> m_Contended{0};
+    std::atomic<std::uint64_t> m_WaitNanoseconds{0};
+
+    PropertyStatsRecord Record() const {
+        PropertyStatsRecord record;
+        record.Name = m_Name;
+        record.Reads = m_Reads.load(std::memory_order_relaxed);
+        record.Writes = m_Writes.load(std::memory_order_relaxed);
+        record.GetterCalls = m_GetterCalls.load(std::memory_order_relaxed);
+        record.SetterCalls = m_SetterCalls.load(std::memory_order_relaxed);
+        record.Contended = m_Contended.load(std::memory_order_relaxed);
+        record.WaitNanoseconds = m_WaitNanoseconds.load(std::memory_order_relaxed);
+        return record;
+    }
+
+    void Reset() {
+        m_Reads.store(0, std::memory_order_relaxed);
+        m_Writes.store(0, std::memory_order_relaxed);
+        m_GetterCalls.store(0, std::memory_order_relaxed);
+        m_SetterCalls.store(0, std::memory_order_relaxed);
+        m_Contended.store(0, std::memory_order_relaxed);
+        m_WaitNanoseconds.store(0, std::memory_order_relaxed);
+    }
+};
+
+} // namespace detail
+
+// Registry of statistics of all properties. Unnamed property is registered by its address while it is
+// alive, named properties with the same name share one record that outlives them.
+// Without PROPP_ENABLE_STATS the registry stays empty
+class StatsRegistry {
+public:
+    static StatsRegistry& Instance() {
+        static StatsRegistry registry;
+        return registry;
+    }
+
+    std::vector<PropertyStatsRecord> Records() const {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        std::vector<PropertyStatsRecord> records;
+        records.reserve(m_Named.size() + m_Unnamed.size());
+        for (const auto& named : m_Named) {
+            records.push_back(named.second->Record());
+        }
+        for (const auto& unnamed : m_Unnamed) {
+            records.push_back(unnamed.second->Record());
+        }
+        return records;
+    }
+
+    // Most contended properties, by lock wait time and then by number of accesses
+    std::vector<PropertyStatsRecord> Top(std::size_t count) const {
+        std::vector<PropertyStatsRecord> records = Records();
+        std::sort(records.begin(), records.end(), [](const PropertyStatsRecord& a, const PropertyStatsRecord& b) {
+            if (a.WaitNanoseconds != b.WaitNanoseconds) {
+                return a.WaitNanoseconds > b.WaitNanoseconds;
+            }
+            return a.Reads + a.Writes > b.Reads + b.Writes;
+        });
+        if (records.size() > count) {
+            records.resize(count);
+        }
+        return records;
+    }
+
+    void Dump(std::FILE* out = stdout, std::size_t count = 10) const {
+        std::fprintf(out, "%-32s %14s %14s %14s %14s %12s %14s\n",
+            "property", "reads", "writes", "getter calls", "setter calls", "contended", "wait us");
+        for (const PropertyStatsRecord& record : Top(count)) {
+            std::fprintf(out, "%-32s %14llu %14llu %14llu %14llu %12llu %14.1f\n", record.Name.c_str(),
+                static_cast<unsigned long long>(record.Reads), static_cast<unsigned long long>(record.Writes),
+                static_cast<unsigned long long>(record.GetterCalls), static_cast<unsigned long long>(record.SetterCalls),
+                static_cast<unsigned long long>(record.Contended), record.WaitNanoseconds / 1000.0);
+        }
+    }
+
+    void Reset() {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        for (auto& named : m_Named) {
+            named.second->Reset();
+        }
+        for (auto& unnamed : m_Unnamed) {
+            unnamed.second->Reset();
+        }
+    }
+
+    std::shared_ptr<detail::StatsEntry> Register(const void* property) {
+        auto entry = std::make_shared<detail::StatsEntry>();
+        char name[32];
+        std::snprintf(name, sizeof(name), "%p", property);
+        entry->m_Name = name;
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Unnamed.emplace(entry.get(), entry);
+        return entry;
+    }
+
+    std::shared_ptr<detail::StatsEntry> Register(const std::string& name) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        auto& entry = m_Named[name];
+        if (!entry) {
+            entry = std::make_shared<detail::StatsEntry>();
+            entry->m_Name = name;
+        }
+        return entry;
+    }
+
+    // Unnamed records are dropped with their property, named ones are kept
+    void Unregister(const std::shared_ptr<detail::StatsEntry>& entry) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Unnamed.erase(entry.get());
+    }
+
+private:
+    StatsRegistry() = default;
+
+    mutable std::mutex m_Mutex;
+    std::unordered_map<std::string, std::shared_ptr<detail::StatsEntry>> m_Named;
+    std::unordered_map<const detail::StatsEntry*, std::shared_ptr<detail::StatsEntry>> m_Unnamed;
+};
+
+namespace detail {
+
+// Statistics of properties that are never counted, literal types so the properties stay constexpr
+// in builds with statistics
+struct NoStats {
+    void SetName(const std::string&) {}
+    constexpr void OnRead() const {}
+    constexpr void OnWrite() const {}
+    constexpr void OnGetter() const {}
+    constexpr void OnSetter() const {}
+};
+
+template <typename Lock>
+struct NoStatsGuard : Lock {
+    template <typename Mutex>
+    constexpr NoStatsGuard(Mutex& mutex, const NoStats&) : Lock(mutex) {}
+};
+
+#if PROPP_ENABLE_STATS
+
+// Statistics member of the property
+class PropertyStats {
+public:
+    PropertyStats() : m_Entry(StatsRegistry::Instance().Register(this)) {}
+    ~PropertyStats() { StatsRegistry::Instance().Unregister(m_Entry); }
+
+    PropertyStats(const PropertyStats&) = delete;
+    PropertyStats& operator=(const PropertyStats&) = delete;
+
+    void SetName(const std::string& name) {
+        StatsRegistry::Instance().Unregister(m_Entry);
+        m_Entry = StatsRegistry::Instance().Register(name);
+    }
+
+    void OnRead() const { m_Entry->m_Reads.fetch_add(1, std::memory_order_relaxed); }
+    void OnWrite() const { m_Entry->m_Writes.fetch_add(1, std::memory_order_relaxed); }
+    void OnGetter() const { m_Entry->m_GetterCalls.fetch_add(1, std::memory_order_relaxed); }
+    void OnSetter() const { m_Entry->m_SetterCalls.fetch_add(1, std::memory_order_relaxed); }
+
+    void OnWait(std::chrono::steady_clock::duration wait) const {
+        m_Entry->m_Contended.fetch_add(1, std::memory_order_relaxed);
+        m_Entry->m_WaitNanoseconds.fetch_add(
+            static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(wait).count()), std::memory_order_relaxed);
+    }
+
+private:
+    std::shared_ptr<StatsEntry> m_Entry;
+};
+
+// Lock taken by the property. Uncontended lock costs one try_lock, only waiting is timed
+template <typename Lock>
+class StatsGuard {
+public:
+    template <typename Mutex>
+    StatsGuard(Mutex& mutex, const PropertyStats&) : m_Lock(mutex) {}
+
+private:
+    Lock m_Lock;
+};
+
+template <typename Mutex>
+class StatsGuard<std::lock_guard<Mutex>> {
+public:
+    StatsGuard(Mutex& mutex, const PropertyStats& stats) : m_Mutex(mutex) {
+        if (!m_Mutex.try_lock()) {
+            const auto begin = std::chrono::steady_clock::now();
+            m_Mutex.lock();
+            stats.OnWait(std::chrono::steady_clock::now() - begin);
+        }
+    }
+    ~StatsGuard() { m_Mutex.unlock(); }
+
+    StatsGuard(const StatsGuard&) = delete;
+    StatsGuard& operator=(const StatsGuard&) = delete;
+
+private:
+    Mutex& m_Mutex;
+};
+
+template <typename Mutex>
+class StatsGuard<std::shared_lock<Mutex>> {
+public:
+    StatsGuard(Mutex& mutex, const PropertyStats& stats) : m_Mutex(mutex) {
+        if (!m_Mutex.try_lock_shared()) {
+            const auto begin = std::chrono::steady_clock::now();
+            m_Mutex.lock_shared();
+            stats.OnWait(std::chrono::steady_clock::now() - begin);
+        }
+    }
+    ~StatsGuard() { m_Mutex.unlock_shared(); }
+
+    StatsGuard(const StatsGuard&) = delete;
+    StatsGuard& operator=(const StatsGuard&) = delete;
+
+private:
+    Mutex& m_Mutex;
+};
+
+#else
+
+using PropertyStats = NoStats;
+
+template <typename Lock>
+using StatsGuard = NoStatsGuard<Lock>;
+
+#endif
+
+} // namespace detail
+
+} // namespace propp
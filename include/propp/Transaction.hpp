@@ -0,0 +1,127 @@
+#pragma once
+
+#include "propp/Property.hpp"
+
+#include <algorithm>
+#include <array>
+#include <type_traits>
+
+namespace propp {
+
+namespace detail {
+
+// Mutex that forwards to a lock shared with other properties, e.g. DomainMutex, exposes it with Target()
+template <typename Mutex, typename = void>
+struct HasLockTarget : std::false_type {};
+
+template <typename Mutex>
+struct HasLockTarget<Mutex, std::void_t<decltype(std::declval<Mutex&>().Target())>> : std::true_type {};
+
+} // namespace detail
+
+// Locks mutexes of several properties once, in address order so concurrent transactions over
+// overlapping properties can't deadlock. Inside the scope reads and writes go through the transaction
+// and skip per-property locking, other threads observe all writes of the transaction together
+// when the transaction ends.
+//
+//     Transaction tx(person.Position, person.Velocity, person.Age);
+//     tx.Set(person.Position, tx.Get(person.Position) + tx.Get(person.Velocity));
+//     tx.Apply(person.Age, [](int& age) { ++age; });
+//
+// Setters are invoked as usual while all locks are held. Properties protected by the same mutex are
+// locked once, DomainLock and StripedLock properties of one domain or stripe too. Readers of SeqLock
+// and Snapshot properties don't lock, so they may see partial transaction, LockFree properties have
+// no mutex and can't take part in transaction
+template <typename... Properties>
+class Transaction {
+public:
+    static_assert(sizeof...(Properties) > 0, "Transaction requires at least one property");
+    static_assert((!Properties::IsAtomic && ...), "LockFree properties can't take part in transaction");
+
+    explicit Transaction(Properties&... properties)
+        : m_Mutexes{ MakeEntry(detail::PropertyAccess::GetMutex(properties))... }
+    {
+        std::sort(m_Mutexes.begin(), m_Mutexes.end(), [](const Entry& a, const Entry& b) {
+            return std::less<void*>()(a.m_Mutex, b.m_Mutex);
+        });
+        std::size_t locked = 0;
+        try {
+            for (; locked < m_Mutexes.size(); ++locked) {
+                if (locked > 0 && m_Mutexes[locked].m_Mutex == m_Mutexes[locked - 1].m_Mutex) {
+                    m_Mutexes[locked].m_Unlock = nullptr;
+                    continue;
+                }
+                m_Mutexes[locked].m_Lock(m_Mutexes[locked].m_Mutex);
+            }
+        } catch (...) {
+            // Destructor doesn't run for a failed constructor, mutexes taken so far are released here
+            UnlockFirst(locked);
+            throw;
+        }
+    }
+
+    ~Transaction() {
+        UnlockFirst(m_Mutexes.size());
+    }
+
+    Transaction(const Transaction&) = delete;
+    Transaction& operator=(const Transaction&) = delete;
+
+    // Reads the property through its getter without locking
+    template <typename P>
+    decltype(auto) Get(P& property) const {
+        return detail::PropertyAccess::GetST(property);
+    }
+
+    // Writes the property through its setter without locking
+    template <typename P, typename F>
+    void Set(P& property, F&& value) {
+        static_assert(!P::IsReadOnly, "Can't set read-only property");
+        using T = typename P::ValueType;
+        if constexpr (std::is_same_v<std::decay_t<F>, T>) {
+            detail::PropertyAccess::SetST(property, std::forward<F>(value));
+        } else {
+            detail::PropertyAccess::SetST(property, static_cast<T>(std::forward<F>(value)));
+        }
+    }
+
+    // Modifies the property in place, same as compound operators, without locking
+    template <typename P, typename Operation>
+    void Apply(P& property, Operation&& operation) {
+        static_assert(!P::IsReadOnly, "Can't modify read-only property");
+        detail::PropertyAccess::ApplyST(property, std::forward<Operation>(operation));
+    }
+
+private:
+    struct Entry {
+        void* m_Mutex;
+        void (*m_Lock)(void*);
+        void (*m_Unlock)(void*);
+    };
+
+    // Unlocks first `count` entries in reverse order
+    void UnlockFirst(std::size_t count) {
+        for (std::size_t i = count; i-- > 0;) {
+            if (m_Mutexes[i].m_Unlock) {
+                m_Mutexes[i].m_Unlock(m_Mutexes[i].m_Mutex);
+            }
+        }
+    }
+
+    template <typename Mutex>
+    static Entry MakeEntry(Mutex& mutex) {
+        if constexpr (detail::HasLockTarget<Mutex>::value) {
+            return MakeEntry(mutex.Target());
+        } else {
+            return Entry{
+                static_cast<void*>(&mutex),
+                [](void* m) { static_cast<Mutex*>(m)->lock(); },
+                [](void* m) { static_cast<Mutex*>(m)->unlock(); }
+            };
+        }
+    }
+
+    std::array<Entry, sizeof...(Properties)> m_Mutexes;
+};
+
+} // namespace propp
@@ -0,0 +1,79 @@
+#include "propp/Async.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace propp;
+
+namespace {
+
+// Runs tasks only when asked, so the test controls when the setter runs
+struct ManualExecutor {
+    std::vector<std::function<void()>> Tasks;
+
+    void Submit(std::function<void()> task) { Tasks.push_back(std::move(task)); }
+
+    bool RunPending() {
+        if (Tasks.empty()) {
+            return false;
+        }
+        auto task = std::move(Tasks.front());
+        Tasks.erase(Tasks.begin());
+        task();
+        return true;
+    }
+};
+
+} // namespace
+
+TEST(Async, WritesAreCoalesced) {
+    ManualExecutor executor;
+    std::vector<int> seen;
+    {
+        PropertyRWS<int, SetterTypeAsync<int, ManualExecutor>> property(0,
+            SetterTypeAsync<int, ManualExecutor>([&](const int& v) { seen.push_back(v); }, executor));
+        property = 1;
+        property = 2;
+        property = 3;
+        EXPECT_EQ(property(), 3);
+        EXPECT_EQ(executor.Tasks.size(), 1u);
+        property.Flush();
+        EXPECT_EQ(seen, std::vector<int>{3});
+        property = 4;
+    }
+    EXPECT_EQ(seen, (std::vector<int>{3, 4}));
+}
+
+TEST(Async, SlowSetterDoesNotBlockWriters) {
+    std::atomic<int> calls{0};
+    std::atomic<int> last{-1};
+    PropertyAsyncMT<int> property(0, SetterTypeAsync<int>([&](const int& v) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        ++calls;
+        last = v;
+    }));
+    for (int i = 1; i <= 100; ++i) {
+        property = i;
+    }
+    EXPECT_EQ(property(), 100);
+    property.Flush();
+    EXPECT_EQ(last, 100);
+    EXPECT_LT(calls, 100);
+}
+
+TEST(Async, FlushRethrowsSetterException) {
+    PropertyAsyncMT<std::string> property(std::string(), SetterTypeAsync<std::string>([](const std::string& v) {
+        if (v == "bad") {
+            throw std::runtime_error("bad value");
+        }
+    }));
+    property = std::string("bad");
+    EXPECT_THROW(property.Flush(), std::runtime_error);
+    EXPECT_NO_THROW(property.Flush());
+}
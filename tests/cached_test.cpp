@@ -0,0 +1,95 @@
+#include "propp/Cached.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <type_traits>
+
+using namespace propp;
+
+namespace {
+
+struct Person {
+    Observed<PropertyRW<std::string>> Street{"Main St"};
+    Observed<PropertyRWMT<std::string>> City{"Mega"};
+    int Computes = 0;
+    PropertyCached<std::string> Address;
+
+    Person() : Address([this]() { ++Computes; return Street() + " " + City(); }) {
+        Address.DependsOn(Street).DependsOn(City);
+    }
+};
+
+} // namespace
+
+TEST(Cached, RecomputesOnlyAfterDependencyChanges) {
+    Person person;
+    EXPECT_EQ(person.Computes, 0);
+    EXPECT_EQ(person.Address(), "Main St Mega");
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(person.Address(), "Main St Mega");
+    }
+    EXPECT_EQ(person.Computes, 1);
+
+    person.Street = "Elm";
+    EXPECT_EQ(person.Computes, 1);
+    EXPECT_EQ(person.Address(), "Elm Mega");
+    EXPECT_EQ(person.Computes, 2);
+
+    person.City += "polis";
+    EXPECT_EQ(person.Address(), "Elm Megapolis");
+    EXPECT_EQ(person.Computes, 3);
+
+    person.Address.Invalidate();
+    EXPECT_EQ(person.Address(), "Elm Megapolis");
+    EXPECT_EQ(person.Computes, 4);
+}
+
+TEST(Cached, SingleThreadedReturnsReferenceMultiThreadedCopies) {
+    PropertyCached<int> st([]() { return 1; });
+    PropertyCachedMT<int> mt([]() { return 2; });
+    static_assert(std::is_same_v<decltype(st()), const int&>, "single-threaded cache is returned by reference");
+    static_assert(std::is_same_v<decltype(mt()), int>, "multi-threaded cache is copied under the lock");
+    EXPECT_EQ(st(), 1);
+    EXPECT_EQ(mt(), 2);
+}
+
+TEST(Cached, ConstPropertyFillsCache) {
+    int computes = 0;
+    const PropertyCached<int> cached([&]() { return ++computes; });
+    EXPECT_EQ(cached(), 1);
+    EXPECT_EQ(cached(), 1);
+    cached.Invalidate();
+    EXPECT_EQ(cached(), 2);
+}
+
+TEST(Cached, ConcurrentReadersSeeLatestValue) {
+    Observed<PropertyRWMT<int>> x{1};
+    PropertyCachedMT<int> square([&]() { return x() * x(); });
+    square.DependsOn(x);
+    std::thread writer([&]() {
+        for (int i = 0; i < 10000; ++i) {
+            x = i;
+        }
+    });
+    std::thread reader([&]() {
+        for (int i = 0; i < 10000; ++i) {
+            int v = square;
+            (void)v;
+        }
+    });
+    writer.join();
+    reader.join();
+    EXPECT_EQ(square(), 9999 * 9999);
+}
+
+TEST(Cached, OutlivesDependency) {
+    PropertyCached<int> cached([]() { return 5; });
+    {
+        Observed<PropertyRW<int>> dependency{0};
+        cached.DependsOn(dependency);
+        dependency = 1;
+    }
+    EXPECT_EQ(cached(), 5);
+}
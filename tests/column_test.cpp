@@ -0,0 +1,128 @@
+#include "propp/Column.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <thread>
+
+using namespace propp;
+
+namespace {
+
+struct Clamp {
+    int operator()(const int& v) const { return std::clamp(v, 0, 150); }
+};
+
+struct Twice {
+    int operator()(const int& v) const { return v * 2; }
+};
+
+} // namespace
+
+TEST(Column, HandleReadsAndWritesElement) {
+    PropertyColumn<int> ages;
+    for (int i = 0; i < 10; ++i) {
+        ages.PushBack(i);
+    }
+    auto age = ages[3];
+    age += 5;
+    EXPECT_EQ(ages[3](), 8);
+    ++age;
+    EXPECT_EQ(age, 9);
+    age = 42;
+    EXPECT_EQ(ages.Data()[3], 42);
+    ages[0] = ages[3];
+    EXPECT_EQ(ages[0](), 42);
+}
+
+TEST(Column, GetterAndSetterFunctors) {
+    PropertyColumn<int, GetterTypeFunctor<Twice>, SetterTypeFunctor<Clamp>> column;
+    column.PushBack(500);
+    EXPECT_EQ(column.GetRaw(0), 150);
+    EXPECT_EQ(column[0](), 300);
+    column[0] -= 200;
+    EXPECT_EQ(column.GetRaw(0), 100);
+}
+
+TEST(Column, TableRowsAndSwapRemove) {
+    PropertyTable<PropertyColumn<int>, PropertyColumn<std::string>> table;
+    table.AddRow(30, "Alice");
+    table.AddRow(40, std::string("Bob"));
+    auto [age, name] = table.Row(1);
+    age += 1;
+    name += "!";
+    EXPECT_EQ(table.Column<0>()[1](), 41);
+    EXPECT_EQ(table.Column<1>()[1](), "Bob!");
+    table.SwapRemove(0);
+    EXPECT_EQ(table.Size(), 1u);
+    EXPECT_EQ(table.Column<1>()[0](), "Bob!");
+}
+
+TEST(Column, ConcurrentCompoundOperators) {
+    PropertyColumnMT<int> column(4);
+    std::thread a([&]() {
+        for (int i = 0; i < 20000; ++i) {
+            column[1] += 1;
+        }
+    });
+    std::thread b([&]() {
+        for (int i = 0; i < 20000; ++i) {
+            ++column[1];
+        }
+    });
+    a.join();
+    b.join();
+    EXPECT_EQ(column[1](), 40000);
+}
+
+TEST(Column, BulkOperatorsAndMasks) {
+    PropertyColumn<int> hp;
+    for (int i = 0; i < 100; ++i) {
+        hp.PushBack(i);
+    }
+    auto low = hp.All() < 10;
+    EXPECT_EQ(low.Count(), 10u);
+    hp.Where(low) += 1000;
+    EXPECT_EQ(hp[0](), 1000);
+    EXPECT_EQ(hp[10](), 10);
+
+    auto middle = (hp.All() >= 20) & (hp.All() < 30);
+    EXPECT_EQ(middle.Count(), 10u);
+    EXPECT_EQ((~middle).Count(), 90u);
+
+    hp.Range(50, 10) <<= 1;
+    EXPECT_EQ(hp[50](), 100);
+    EXPECT_EQ(hp[60](), 60);
+}
+
+TEST(Column, BulkOperatorsGoThroughSetter) {
+    PropertyColumn<int, NoGetter, SetterTypeFunctor<Clamp>> column(10, 100);
+    column.All() += 100;
+    EXPECT_EQ(column[5](), 150);
+    column.All().Fill(-3);
+    EXPECT_EQ(column[2](), 0);
+
+    PropertyColumn<float> scores(1000, 100.f);
+    scores.All() *= 0.5;
+    EXPECT_EQ(scores[999](), 50.f);
+}
+
+TEST(Column, PaddedLockPolicyIsUnwrapped) {
+    PropertyColumn<int, NoGetter, NoSetter, Padded<RecursiveLock>> column(8, 1);
+    column.All() += 1;
+    EXPECT_EQ(column[7](), 2);
+}
+
+#ifndef NDEBUG
+TEST(ColumnDeathTest, RangeOutsideColumnAsserts) {
+    PropertyColumn<int> column(10);
+    EXPECT_DEATH(column.Range(5, 6), "range is outside the column");
+    EXPECT_DEATH(column.Range(11, 0), "range is outside the column");
+
+    // Range taken before the column shrank
+    auto range = column.Range(0, 10);
+    column.Resize(5);
+    EXPECT_DEATH(range += 1, "range is outside the column");
+}
+#endif
@@ -0,0 +1,97 @@
+#include "propp/Coroutine.hpp"
+#include "propp/Parallel.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <exception>
+#include <vector>
+
+using namespace propp;
+
+namespace {
+
+// Starts eagerly and keeps its frame until destroyed, so the test can check done()
+struct Task {
+    struct promise_type {
+        Task get_return_object() { return {std::coroutine_handle<promise_type>::from_promise(*this)}; }
+        std::suspend_never initial_suspend() { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+
+    ~Task() {
+        if (m_Handle) {
+            m_Handle.destroy();
+        }
+    }
+
+    bool Done() const { return m_Handle.done(); }
+
+    std::coroutine_handle<promise_type> m_Handle;
+};
+
+Task Watch(Observed<PropertyRWMT<int>>& property, ChangeQueue& queue, std::vector<int>& seen) {
+    seen.push_back(co_await Changed(property, queue));
+    seen.push_back(co_await When(property, queue, [](int v) { return v >= 10; }));
+    // Already satisfied, doesn't suspend
+    seen.push_back(co_await When(property, queue, [](int v) { return v >= 10; }));
+}
+
+Task WatchOnPool(Observed<PropertyRWMT<int>>& property, ThreadPool& pool, std::atomic<int>& result) {
+    result = co_await When(property, pool, [](int v) { return v == 42; });
+}
+
+Task NeverResumed(Observed<PropertyRW<int>>& property, ChangeQueue& queue, bool& resumed) {
+    co_await Changed(property, queue);
+    resumed = true;
+}
+
+} // namespace
+
+TEST(Coroutine, ResumedByQueueWithLatestValue) {
+    Observed<PropertyRWMT<int>> property(0);
+    ChangeQueue queue;
+    std::vector<int> seen;
+    Task task = Watch(property, queue, seen);
+    EXPECT_TRUE(seen.empty());
+    property = 1;
+    property = 2;
+    queue.Flush();
+    EXPECT_EQ(seen, std::vector<int>{2});
+    property = 5;
+    queue.Flush();
+    EXPECT_EQ(seen.size(), 1u);
+    property = 11;
+    property = 12;
+    queue.Flush();
+    EXPECT_EQ(seen, (std::vector<int>{2, 12, 12}));
+    EXPECT_TRUE(task.Done());
+}
+
+TEST(Coroutine, ResumedOnExecutor) {
+    ThreadPool pool(2);
+    Observed<PropertyRWMT<int>> property(0);
+    std::atomic<int> result{0};
+    Task task = WatchOnPool(property, pool, result);
+    for (int i = 0; i <= 50; ++i) {
+        property = i;
+    }
+    while (result.load() == 0) {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(result, 42);
+}
+
+TEST(Coroutine, DestroyedAwaiterIsNotResumed) {
+    ChangeQueue queue;
+    Observed<PropertyRW<int>> property(0);
+    bool resumed = false;
+    {
+        Task task = NeverResumed(property, queue, resumed);
+    }
+    property = 3;
+    queue.Flush();
+    EXPECT_FALSE(resumed);
+}
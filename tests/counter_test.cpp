@@ -0,0 +1,35 @@
+#include "propp/Counter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+using namespace propp;
+
+TEST(Counter, ConcurrentIncrementsAreSummed) {
+    PropertyCounter<std::uint64_t> counter;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([&]() {
+            for (int i = 0; i < 10000; ++i) {
+                ++counter;
+                counter += 2;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(counter(), 8 * 30000u);
+    EXPECT_EQ(counter.Exchange(), 8 * 30000u);
+    EXPECT_EQ(counter, 0u);
+}
+
+TEST(Counter, AssignAndSubtract) {
+    PropertyCounter<int> counter;
+    counter = 5;
+    counter -= 2;
+    EXPECT_EQ(counter, 3);
+    EXPECT_GT(counter, 1);
+}
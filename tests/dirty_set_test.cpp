@@ -0,0 +1,70 @@
+#include "propp/DirtySet.hpp"
+#include "propp/Observer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <thread>
+#include <vector>
+
+using namespace propp;
+
+namespace {
+
+struct Entity {
+    DirtySet Dirty;
+    Tracked<PropertyRW<int>> Health{100};
+    Tracked<PropertyRWMT<float>> X{0.f};
+    WithHooks<PropertyRW<int>, HookList<Observable, DirtyTracked>> Score{0};
+
+    Entity() {
+        Dirty.Track(Health);
+        Dirty.Track(X);
+        Dirty.Track(Score);
+    }
+};
+
+} // namespace
+
+TEST(DirtySet, ConsumeVisitsChangedPropertiesOnce) {
+    Entity entity;
+    EXPECT_FALSE(entity.Dirty.Any());
+    entity.Health = 5;
+    entity.Health -= 1;
+    int observed = 0;
+    auto subscription = entity.Score.Subscribe([&](const int&) { ++observed; });
+    entity.Score += 3;
+
+    std::vector<std::size_t> changed;
+    EXPECT_EQ(entity.Dirty.ConsumeDirty([&](std::size_t index) { changed.push_back(index); }), 2u);
+    EXPECT_EQ(changed, (std::vector<std::size_t>{0, 2}));
+    EXPECT_EQ(observed, 1);
+    EXPECT_FALSE(entity.Dirty.Any());
+}
+
+TEST(DirtySet, ConcurrentWritersMarkTheirProperties) {
+    DirtySet dirty;
+    std::deque<Tracked<PropertyRWMT<int>>> properties(200);
+    for (auto& property : properties) {
+        dirty.Track(property);
+    }
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int i = t; i < 200; i += 7) {
+                properties[i] += 1;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    std::size_t expected = 0;
+    for (int i = 0; i < 200; ++i) {
+        expected += i % 7 < 4;
+    }
+    EXPECT_EQ(dirty.ConsumeDirty([](std::size_t index) { EXPECT_LT(index % 7, 4u); }), expected);
+
+    dirty.MarkAll();
+    EXPECT_EQ(dirty.ConsumeDirty([](std::size_t) {}), 200u);
+}
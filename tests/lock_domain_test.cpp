@@ -0,0 +1,103 @@
+#include "propp/LockDomain.hpp"
+#include "propp/Transaction.hpp"
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <thread>
+#include <vector>
+
+using namespace propp;
+
+namespace {
+
+struct Account {
+    LockDomain Domain;
+    PropertyRWDomainMT<int> Balance{0};
+    PropertyRWDomainMT<int> Reserved{0};
+
+    Account() { BindLockDomain(Domain, Balance, Reserved); }
+};
+
+} // namespace
+
+TEST(LockDomain, PropertiesShareOwnerLock) {
+    Account account;
+    EXPECT_EQ(&detail::PropertyAccess::GetMutex(account.Balance).Target(), &account.Domain);
+    EXPECT_EQ(&detail::PropertyAccess::GetMutex(account.Reserved).Target(), &account.Domain);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&]() {
+            for (int i = 0; i < 5000; ++i) {
+                Transaction tx(account.Balance, account.Reserved);
+                tx.Set(account.Balance, tx.Get(account.Balance) - 1);
+                tx.Apply(account.Reserved, [](int& v) { ++v; });
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(account.Balance, -20000);
+    EXPECT_EQ(account.Reserved, 20000);
+}
+
+TEST(LockDomain, TransactionLocksDomainOnce) {
+    Account account;
+    account.Domain.ResetStats();
+    {
+        Transaction tx(account.Balance, account.Reserved);
+        tx.Set(account.Balance, 1);
+    }
+    EXPECT_EQ(account.Domain.Stats().Acquisitions, 1u);
+
+    // Plain writes under the domain lock keep invariants between properties
+    {
+        std::lock_guard<LockDomain> lock(account.Domain);
+        account.Balance -= 5;
+        account.Reserved += 5;
+    }
+    EXPECT_EQ(account.Balance() + account.Reserved(), 1);
+}
+
+TEST(LockDomain, StripedPropertiesTakeNoSpace) {
+#if PROPP_HAS_NO_UNIQUE_ADDRESS && !PROPP_ENABLE_STATS
+    EXPECT_EQ(sizeof(PropertyRWStripedMT<int>), sizeof(int));
+#endif
+    static PropertyRWStripedMT<int> counters[256];
+    StripedLockTable::Default().ResetStats();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([t]() {
+            for (int i = 0; i < 10000; ++i) {
+                counters[(i * 7 + t) % 256] += 1;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    int sum = 0;
+    for (auto& counter : counters) {
+        sum += counter;
+    }
+    EXPECT_EQ(sum, 40000);
+
+    const auto stats = StripedLockTable::Default().Stats();
+    EXPECT_EQ(stats.size(), StripedLockTable::Default().Size());
+    std::uint64_t acquisitions = 0;
+    for (const auto& stripe : stats) {
+        acquisitions += stripe.Acquisitions;
+    }
+    EXPECT_GE(acquisitions, 40000u);
+}
+
+TEST(LockDomain, BindToOwnTable) {
+    StripedLockTable table(8);
+    PropertyRWDomainMT<int> value(1);
+    BindLockDomain(table, value);
+    EXPECT_EQ(&detail::PropertyAccess::GetMutex(value).Target(), &table.For(&value));
+    value = 2;
+    EXPECT_EQ(value, 2);
+}
@@ -0,0 +1,162 @@
+#include "propp/MappedStore.hpp"
+#include "propp/Parallel.hpp"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/wait.h>
+#include <unistd.h>
+#define PROPP_TEST_FORK 1
+#endif
+
+using namespace propp;
+
+namespace {
+
+struct Vec {
+    float x, y, z;
+};
+
+// Fresh store directory per test, removed afterwards
+class MappedStoreTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_Path = std::filesystem::temp_directory_path() /
+            ("propp_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()));
+        std::filesystem::remove_all(m_Path);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(m_Path); }
+
+    std::filesystem::path m_Path;
+};
+
+} // namespace
+
+TEST_F(MappedStoreTest, ColumnsSurviveReopen) {
+    {
+        MappedPropertyStore store(m_Path);
+        PropertyColumnMapped<int> a(store.Open<int>("a"));
+        for (int i = 0; i < 1000; ++i) {
+            a.PushBack(i);
+        }
+        a[5] = 50;
+        a.All() += 1;
+        a.SwapRemove(0);
+        ParallelForEach(a, [](int& v) { v *= 2; });
+        PropertyColumnMapped<Vec, NoGetter, NoSetter, RecursiveLock> v(store.Open<Vec>("v"));
+        v.Resize(10);
+        v[3] = Vec{1, 2, 3};
+    }
+    MappedPropertyStore store(m_Path);
+    PropertyColumnMapped<int> a(store.Open<int>("a"));
+    ASSERT_EQ(a.Size(), 999u);
+    EXPECT_EQ(a[0], 2 * 1000);
+    EXPECT_EQ(a[4], 2 * 5);
+    EXPECT_EQ(a[5], 2 * 51);
+    PropertyColumnMapped<Vec> v(store.Open<Vec>("v"));
+    ASSERT_EQ(v.Size(), 10u);
+    EXPECT_EQ(v[3]().y, 2);
+}
+
+TEST_F(MappedStoreTest, OpenChecksColumns) {
+    MappedPropertyStore store(m_Path);
+    {
+        auto v = store.Open<Vec>("v");
+        EXPECT_THROW(store.Open<Vec>("v"), std::logic_error);
+    }
+    EXPECT_THROW(store.Open<double>("v"), std::runtime_error);
+}
+
+TEST_F(MappedStoreTest, ClosingColumnKeepsOthersOpen) {
+    MappedPropertyStore store(m_Path);
+    auto a = store.Open<int>("a");
+    auto b = store.Open<int>("b");
+    {
+        auto c = store.Open<int>("c");
+    }
+    EXPECT_THROW(store.Open<int>("a"), std::logic_error);
+    EXPECT_THROW(store.Open<int>("b"), std::logic_error);
+    EXPECT_NO_THROW(store.Open<int>("c"));
+}
+
+#ifdef PROPP_TEST_FORK
+TEST_F(MappedStoreTest, JournalRecoversCommittedWrites) {
+    const pid_t pid = fork();
+    if (pid == 0) {
+        // Crash without destructors after the commit
+        auto* store = new MappedPropertyStore(m_Path, MappedPropertyStore::Journaled);
+        auto* a = new PropertyColumnMapped<long>(store->Open<long>("a"));
+        for (long i = 0; i < 10000; ++i) {
+            a->PushBack(i);
+        }
+        (*a)[7] = -7;
+        a->Range(10, 5) *= 3;
+        store->Commit();
+        (*a)[8] = 12345;
+        _exit(0);
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+    ASSERT_TRUE(WIFEXITED(status));
+
+    // Lose the data pages, only the journal is left
+    const auto column = m_Path / "a.column";
+    const auto size = std::filesystem::file_size(column);
+    std::filesystem::resize_file(column, 0);
+    std::filesystem::resize_file(column, size / 2);
+
+    MappedPropertyStore store(m_Path, MappedPropertyStore::Journaled);
+    EXPECT_EQ(std::filesystem::file_size(m_Path / "journal"), 0u);
+    PropertyColumnMapped<long> a(store.Open<long>("a"));
+    ASSERT_EQ(a.Size(), 10000u);
+    EXPECT_EQ(a[6], 6);
+    EXPECT_EQ(a[7], -7);
+    EXPECT_EQ(a[11], 33);
+    EXPECT_EQ(a[9999], 9999);
+}
+
+TEST_F(MappedStoreTest, JournalRecoversEveryColumn) {
+    const pid_t pid = fork();
+    if (pid == 0) {
+        auto* store = new MappedPropertyStore(m_Path, MappedPropertyStore::Journaled);
+        auto* a = new PropertyColumnMapped<int>(store->Open<int>("a"));
+        auto* b = new PropertyColumnMapped<int>(store->Open<int>("b"));
+        auto* c = new PropertyColumnMapped<double>(store->Open<double>("c"));
+        a->PushBack(1);
+        a->PushBack(2);
+        for (int i = 0; i < 5; ++i) {
+            b->PushBack(100 + i);
+        }
+        c->PushBack(0.5);
+        (*b)[1] = -1;
+        store->Commit();
+        _exit(0);
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+    ASSERT_TRUE(WIFEXITED(status));
+
+    for (const char* name : {"a.column", "b.column", "c.column"}) {
+        std::filesystem::resize_file(m_Path / name, 0);
+    }
+
+    MappedPropertyStore store(m_Path, MappedPropertyStore::Journaled);
+    PropertyColumnMapped<int> a(store.Open<int>("a"));
+    PropertyColumnMapped<int> b(store.Open<int>("b"));
+    PropertyColumnMapped<double> c(store.Open<double>("c"));
+    ASSERT_EQ(a.Size(), 2u);
+    EXPECT_EQ(a[0], 1);
+    EXPECT_EQ(a[1], 2);
+    ASSERT_EQ(b.Size(), 5u);
+    EXPECT_EQ(b[0], 100);
+    EXPECT_EQ(b[1], -1);
+    EXPECT_EQ(b[4], 104);
+    ASSERT_EQ(c.Size(), 1u);
+    EXPECT_EQ(c[0], 0.5);
+}
+#endif
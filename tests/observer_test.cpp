@@ -0,0 +1,79 @@
+#include "propp/Observer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+using namespace propp;
+
+TEST(Observer, ImmediateSubscriberSeesEveryWrite) {
+    Observed<PropertyRW<int>> value{1};
+    int seen = 0;
+    int calls = 0;
+    {
+        auto subscription = value.Subscribe([&](const int& v) { seen = v; ++calls; });
+        value = 5;
+        EXPECT_EQ(seen, 5);
+        value += 2;
+        EXPECT_EQ(seen, 7);
+        value.Emplace(9);
+        EXPECT_EQ(seen, 9);
+        EXPECT_EQ(calls, 3);
+    }
+    value = 10;
+    EXPECT_EQ(calls, 3);
+}
+
+TEST(Observer, QueueCoalescesWrites) {
+    Observed<PropertyRWMT<int>> value{0};
+    ChangeQueue queue;
+    int seen = 0;
+    int calls = 0;
+    auto subscription = value.Subscribe(queue, [&](const int& v) { seen = v; ++calls; });
+    std::thread writer([&]() {
+        for (int i = 1; i <= 1000; ++i) {
+            value = i;
+        }
+    });
+    writer.join();
+    EXPECT_EQ(queue.Pending(), 1u);
+    EXPECT_EQ(queue.Flush(), 1u);
+    EXPECT_EQ(seen, 1000);
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(queue.Flush(), 0u);
+
+    value = 3;
+    subscription.Reset();
+    EXPECT_EQ(queue.Flush(), 0u);
+}
+
+TEST(Observer, SubscriberMayUnsubscribeItself) {
+    Observed<PropertyRW<int>> value{0};
+    Subscription self;
+    int calls = 0;
+    self = value.Subscribe([&](const int&) { ++calls; self.Reset(); });
+    value = 1;
+    value = 2;
+    EXPECT_EQ(calls, 1);
+}
+
+TEST(Observer, SetterWriteIsReportedOnce) {
+    Observed<PropertyRWS<int>> value;
+    value.SetSetter([&](int v) { value = v * 2; });
+    int calls = 0;
+    int seen = 0;
+    auto subscription = value.Subscribe([&](const int& v) { ++calls; seen = v; });
+    value = 4;
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(seen, 8);
+}
+
+TEST(Observer, DestroyedPropertyDropsQueuedChange) {
+    ChangeQueue queue;
+    {
+        Observed<PropertyRW<int>> value{0};
+        auto subscription = value.Subscribe(queue, [](const int&) {});
+        value = 1;
+    }
+    EXPECT_EQ(queue.Flush(), 0u);
+}
@@ -0,0 +1,72 @@
+#include "propp/Parallel.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+using namespace propp;
+
+namespace {
+
+struct Clamp {
+    int operator()(const int& v) const { return std::clamp(v, 0, 150); }
+};
+
+} // namespace
+
+TEST(Parallel, ForEachVisitsEveryElement) {
+    PropertyColumn<int> column(100003, 1);
+    ParallelForEach(column, [](int& v) { v *= 3; });
+    ParallelTransform(column, [](const int& v) { return v + 1; });
+    EXPECT_EQ(std::accumulate(column.Data(), column.Data() + column.Size(), 0LL), 4LL * 100003);
+}
+
+TEST(Parallel, ForEachGoesThroughSetter) {
+    PropertyColumnMT<int, NoGetter, SetterTypeFunctor<Clamp>> column(10000, 100);
+    ParallelForEach(column, [](int& v) { v += 100; });
+    for (std::size_t i = 0; i < column.Size(); ++i) {
+        ASSERT_EQ(column.GetRaw(i), 150);
+    }
+}
+
+TEST(Parallel, ForEachOverPropertyVector) {
+    std::vector<PropertyRW<int>> properties(10000);
+    ParallelForEach(properties, [](PropertyRW<int>& p) { p += 2; });
+    ParallelTransform(properties, [](const int& v) { return v * 5; });
+    for (auto& property : properties) {
+        ASSERT_EQ(property, 10);
+    }
+}
+
+TEST(Parallel, NestedLoopsAndExceptions) {
+    std::atomic<long> total{0};
+    ParallelFor(64, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            ParallelFor(1000, [&](std::size_t first, std::size_t last) { total += static_cast<long>(last - first); });
+        }
+    });
+    EXPECT_EQ(total, 64 * 1000);
+    EXPECT_THROW(ParallelFor(100000, [](std::size_t begin, std::size_t) {
+        if (begin > 10) {
+            throw 1;
+        }
+    }, nullptr, 4), int);
+}
+
+TEST(Parallel, ChunksStartOnCacheLines) {
+    alignas(64) static char buffer[4096];
+    auto bounds = detail::ChunkBoundaries(buffer + 4, 4, 1000, 8);
+    for (std::size_t k = 1; k + 1 < bounds.size(); ++k) {
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(buffer + 4 + bounds[k] * 4) % 64, 0u);
+    }
+}
+
+TEST(Parallel, OwnThreadPool) {
+    ThreadPool pool(3);
+    PropertyColumn<int> column(1000, 1);
+    ParallelForEach(column, [](int& v) { v = 0; }, pool);
+    EXPECT_EQ(std::accumulate(column.Data(), column.Data() + column.Size(), 0), 0);
+}
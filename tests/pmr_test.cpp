@@ -0,0 +1,78 @@
+#include "propp/Pmr.hpp"
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <string>
+
+using namespace propp;
+
+namespace {
+
+struct CountingResource : std::pmr::memory_resource {
+    int Allocations = 0;
+    int Deallocations = 0;
+
+    void* do_allocate(std::size_t size, std::size_t alignment) override {
+        ++Allocations;
+        return std::pmr::new_delete_resource()->allocate(size, alignment);
+    }
+
+    void do_deallocate(void* p, std::size_t size, std::size_t alignment) override {
+        ++Deallocations;
+        std::pmr::new_delete_resource()->deallocate(p, size, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+struct Big {
+    char Padding[128];
+    int Value;
+
+    int operator()() const { return Value; }
+};
+
+} // namespace
+
+TEST(Pmr, AllocatorAwareValueStaysInArena) {
+    char buffer[4096];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer));
+    PropertyRW<std::pmr::string> text(std::allocator_arg, std::pmr::polymorphic_allocator<char>(&arena),
+        "a long string that will not fit in the small buffer");
+    EXPECT_EQ(text().get_allocator().resource(), &arena);
+    text.Emplace("another long string that does not fit in the small buffer");
+    EXPECT_EQ(text().get_allocator().resource(), &arena);
+    EXPECT_EQ(text(), "another long string that does not fit in the small buffer");
+}
+
+TEST(Pmr, FunctionAllocatesOnlyLargeCallables) {
+    CountingResource resource;
+    int x = 5;
+    PmrFunction<int()> small([&x]() { return x; }, &resource);
+    EXPECT_EQ(small(), 5);
+    EXPECT_EQ(resource.Allocations, 0);
+    {
+        PmrFunction<int()> big(Big{{}, 7}, &resource);
+        EXPECT_EQ(resource.Allocations, 1);
+        PmrFunction<int()> copy(big);
+        EXPECT_EQ(resource.Allocations, 2);
+        EXPECT_EQ(copy.Resource(), &resource);
+        PmrFunction<int()> moved(std::move(copy));
+        EXPECT_EQ(resource.Allocations, 2);
+        EXPECT_FALSE(copy);
+        EXPECT_EQ(moved(), 7);
+    }
+    EXPECT_EQ(resource.Deallocations, 2);
+    EXPECT_THROW(PmrFunction<void()>{}(), std::bad_function_call);
+}
+
+TEST(Pmr, PropertyWithPmrGetterAndSetter) {
+    CountingResource resource;
+    int stored = 0;
+    PropertyRWGS<int, GetterTypePmrValue<int>, SetterTypePmrCRef<int>> property(0,
+        GetterTypePmrValue<int>([&]() { return stored * 2; }, &resource),
+        SetterTypePmrCRef<int>([&](const int& v) { stored = v; }, &resource));
+    property = 21;
+    EXPECT_EQ(property(), 42);
+}
@@ -0,0 +1,532 @@
+#include "propp/Property.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using namespace propp;
+
+namespace {
+
+struct Person {
+    int SetterCalls = 0;
+
+    void SetAge(int value) {
+        ++SetterCalls;
+        Age = std::clamp(value, 0, 150);
+    }
+    std::string GetName() const { return Name.GetRaw() + "!"; }
+
+    PropertyRWS<int, SetterTypeRelative<&Person::SetAge>> Age{0, this};
+    PropertyRWG<std::string, GetterTypeRelative<&Person::GetName>> Name{"Ann", this};
+};
+
+using RelativeAge = decltype(Person::Age);
+
+// Balance is kept in cents, getter and setter are bound to member functions at compile time
+struct Account {
+    mutable int GetterCalls = 0;
+
+    int GetBalance() const {
+        ++GetterCalls;
+        return Balance.GetRaw() / 100;
+    }
+    void SetBalance(int value) { Balance = std::max(value, 0) * 100; }
+
+    PropertyRWGS<int, GetterTypeMethod<&Account::GetBalance>, SetterTypeMethod<&Account::SetBalance>> Balance{0, this, this};
+};
+
+// Value followed by the reentrancy flag of the setter
+struct ValueAndFlag {
+    int Value;
+    bool SetterActive;
+};
+
+struct Frame {
+    int Tick = 0;
+    int Negated = 0;
+};
+
+// Spans several machine words, torn read mixes fields of different writes
+struct Sample {
+    std::int64_t Value = 0;
+    std::int64_t Negated = 0;
+    std::int64_t Doubled = 0;
+};
+
+// Counts copies and moves made of it
+struct Tracked {
+    static inline int Copies = 0;
+    static inline int Moves = 0;
+
+    int Value = 0;
+
+    Tracked() = default;
+    explicit Tracked(int value) noexcept : Value(value) {}
+    Tracked(const Tracked& other) : Value(other.Value) { ++Copies; }
+    Tracked(Tracked&& other) noexcept : Value(other.Value) { ++Moves; }
+    Tracked& operator=(const Tracked& other) {
+        Value = other.Value;
+        ++Copies;
+        return *this;
+    }
+    Tracked& operator=(Tracked&& other) noexcept {
+        Value = other.Value;
+        ++Moves;
+        return *this;
+    }
+
+    static void Reset() {
+        Copies = 0;
+        Moves = 0;
+    }
+};
+
+// Counters written by different threads
+struct PaddedCounters {
+    PropertyRWMTPadded<int> First{0};
+    PropertyRWMTPadded<int> Second{0};
+    PropertyRWAtomicPadded<int> Third{0};
+};
+
+template <typename P, typename = void>
+struct HasSetGetter : std::false_type {};
+template <typename P>
+struct HasSetGetter<P, std::void_t<decltype(std::declval<P&>().SetGetter(std::declval<const typename P::Getter&>()))>> : std::true_type {};
+
+template <typename P, typename = void>
+struct HasSetSetter : std::false_type {};
+template <typename P>
+struct HasSetSetter<P, std::void_t<decltype(std::declval<P&>().SetSetter(std::declval<const typename P::Setter&>()))>> : std::true_type {};
+
+// Value that records who holds the property lock: copies are made by readers under the shared lock,
+// assignments by writers under the exclusive lock
+struct LockProbe {
+    static inline std::atomic<int> Readers{0};
+    static inline std::atomic<int> MaxReaders{0};
+    static inline std::atomic<bool> Writing{false};
+    static inline std::atomic<bool> Overlap{false};
+    static inline std::atomic<bool> WaitForPeer{false};
+
+    int Value = 0;
+
+    LockProbe() = default;
+    LockProbe(const LockProbe& other) : Value(other.Value) {
+        if (Writing) {
+            Overlap = true;
+        }
+        const int readers = ++Readers;
+        MaxReaders = std::max(MaxReaders.load(), readers);
+        // Blocks until a second reader holds the lock too, exclusive read lock would time out here
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (WaitForPeer && MaxReaders < 2 && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+        --Readers;
+    }
+    LockProbe& operator=(const LockProbe& other) {
+        Writing = true;
+        if (Readers > 0) {
+            Overlap = true;
+        }
+        std::this_thread::yield();
+        Value = other.Value;
+        if (Readers > 0) {
+            Overlap = true;
+        }
+        Writing = false;
+        return *this;
+    }
+};
+
+// Runs `body(thread)` on `count` threads and waits for them
+template <typename Body>
+void RunThreads(int count, Body body) {
+    std::vector<std::thread> threads;
+    for (int t = 0; t < count; ++t) {
+        threads.emplace_back(body, t);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+} // namespace
+
+TEST(Property, LayoutHasNoOverhead) {
+#if PROPP_HAS_NO_UNIQUE_ADDRESS && !PROPP_ENABLE_STATS
+    // Properties without mutex, getter and setter carry nothing but the value
+    static_assert(sizeof(PropertyRW<int>) == sizeof(int), "PropertyRW must have no overhead");
+    static_assert(sizeof(PropertyRO<double>) == sizeof(double), "PropertyRO must have no overhead");
+    static_assert(sizeof(PropertyRW<char>) == sizeof(char), "PropertyRW must have no overhead");
+    static_assert(sizeof(PropertyRWAtomic<int>) == sizeof(int), "PropertyRWAtomic must have no overhead");
+    static_assert(sizeof(PropertyRWMT<int>) <= sizeof(std::recursive_mutex) + alignof(std::recursive_mutex), "PropertyRWMT must carry only value and mutex");
+
+    using FunctorSetter = PropertyRWS<int, SetterTypeFunctor<std::negate<int>>>;
+    static_assert(sizeof(FunctorSetter) == sizeof(ValueAndFlag), "Setter functor must take no space, only value and reentrancy flag remain");
+    static_assert(sizeof(FunctorSetter) < sizeof(PropertyRWS<int>), "Setter functor must be smaller than std::function setter");
+#endif
+
+    // Padded properties never share a cache line with their neighbours
+    static_assert(alignof(PropertyRWMTPadded<int>) == detail::CacheLineSize, "PropertyRWMTPadded must start a cache line");
+    static_assert(sizeof(PropertyRWAtomicPadded<int>) == detail::CacheLineSize, "PropertyRWAtomicPadded must fill a cache line");
+}
+
+TEST(Property, PlainPropertiesAreConstexpr) {
+    // Properties without lock, getter and setter are literal types, static tables of them are constant-initialized
+    static_assert(PropertyRO<int>(42) == 42 && PropertyRW<double>(0.5) == 0.5, "PropertyRO and PropertyRW must be usable in constant expressions");
+    static_assert(std::is_trivially_destructible_v<PropertyRO<int>>, "PropertyRO must be trivially destructible");
+
+    struct Endpoint {
+        PropertyRO<int> Port;
+        PropertyRO<bool> Tls;
+    };
+    static constexpr Endpoint endpoints[] = { {80, false}, {443, true} };
+    static_assert(endpoints[0].Port == 80 && endpoints[1].Port + 1 == 444, "table must be readable at compile time");
+    EXPECT_TRUE(endpoints[1].Tls);
+}
+
+TEST(Property, RelativeBindingsRelocateOnlyWithOwner) {
+    static_assert(std::is_copy_constructible_v<Person> && std::is_move_constructible_v<Person>, "owner is copyable");
+    static_assert(std::is_copy_assignable_v<Person> && std::is_move_assignable_v<Person>, "owner is assignable");
+    static_assert(!std::is_copy_constructible_v<RelativeAge> && !std::is_move_constructible_v<RelativeAge>,
+        "standalone copy would call the setter of a missing owner");
+    static_assert(!std::is_copy_assignable_v<RelativeAge> && !std::is_move_assignable_v<RelativeAge>,
+        "standalone assignment is available to the owner only");
+    static_assert(std::is_copy_constructible_v<PropertyRW<int>>, "properties without relative bindings stay copyable");
+}
+
+TEST(Property, OwnerCopyCallsItsOwnSetter) {
+    Person john;
+    john.Age = 20;
+    Person copy(john);
+    EXPECT_EQ(copy.SetterCalls, 1);     // copy takes the raw value without invoking the setter
+    copy.Age = 200;
+    EXPECT_EQ(copy.Age, 150);
+    EXPECT_EQ(copy.SetterCalls, 2);
+    EXPECT_EQ(john.Age, 20);
+    EXPECT_EQ(john.SetterCalls, 1);
+    EXPECT_EQ(copy.Name(), "Ann!");
+}
+
+TEST(Property, OwnerAssignmentKeepsBindings) {
+    Person john;
+    john.Age = 30;
+    Person other;
+    other = john;
+    EXPECT_EQ(other.Age, 30);
+    other.Age = -1;
+    EXPECT_EQ(other.Age, 0);
+    EXPECT_EQ(john.Age, 30);
+}
+
+TEST(Property, OwnersRelocatedByVector) {
+    std::vector<Person> people(4);
+    for (int i = 0; i < 64; ++i) {
+        people.emplace_back();
+    }
+    for (Person& person : people) {
+        person.Age = -5;
+    }
+    for (const Person& person : people) {
+        EXPECT_EQ(person.Age, 0);
+        EXPECT_EQ(person.SetterCalls, 1);
+    }
+}
+
+TEST(Property, TripleBufferedReadWithinContractIsConsistent) {
+    PropertyTripleBuffered<Frame> state;
+    std::atomic<int> reads{0};
+    std::thread writer([&]() {
+        // Paced by the reader, so some reads finish before the next write
+        for (int i = 1; i <= 20000; ++i) {
+            while (reads.load() < i) {
+                std::this_thread::yield();
+            }
+            state = Frame{i, -i};
+        }
+    });
+    int checked = 0;
+    while (state.Version() < 20000) {
+        const std::uint64_t version = state.Version();
+        const Frame& frame = state();
+        const Frame copy = frame;
+        if (state.Version() - version < 2) {
+            EXPECT_EQ(copy.Tick, -copy.Negated);
+            ++checked;
+        }
+        reads.fetch_add(1);
+    }
+    writer.join();
+    EXPECT_EQ(state().Tick, 20000);
+    EXPECT_GT(checked, 0);
+}
+
+TEST(Property, SeqLockReadersNeverSeeTornValue) {
+    PropertyRWSeqLock<Sample> sample;
+    std::atomic<bool> done{false};
+    std::atomic<int> torn{0};
+    std::atomic<int> reads{0};
+    RunThreads(4, [&](int t) {
+        if (t == 0) {
+            for (std::int64_t i = 1; i <= 100000; ++i) {
+                sample = Sample{i, -i, 2 * i};
+            }
+            done = true;
+            return;
+        }
+        while (!done) {
+            const Sample copy = sample;
+            if (copy.Negated != -copy.Value || copy.Doubled != 2 * copy.Value) {
+                ++torn;
+            }
+            ++reads;
+        }
+    });
+    EXPECT_EQ(torn, 0);
+    EXPECT_GT(reads, 0);
+    EXPECT_EQ(Sample(sample).Value, 100000);
+}
+
+TEST(Property, SnapshotStaysValidAfterWrites) {
+    PropertyRWSnapshot<std::vector<int>> routes(std::vector<int>{1, 2, 3});
+    const std::shared_ptr<const std::vector<int>> old = routes();
+
+    // Update modifies a copy and publishes it, the old snapshot keeps its own storage
+    routes.Update([](std::vector<int>& r) { r.push_back(4); });
+    const auto updated = routes();
+    EXPECT_NE(updated.get(), old.get());
+    EXPECT_NE(updated->data(), old->data());
+    EXPECT_EQ(*updated, (std::vector<int>{1, 2, 3, 4}));
+    EXPECT_EQ(*old, (std::vector<int>{1, 2, 3}));
+
+    routes = std::vector<int>{9};
+    EXPECT_EQ(*routes(), std::vector<int>{9});
+    EXPECT_EQ(*updated, (std::vector<int>{1, 2, 3, 4}));
+    EXPECT_EQ(*old, (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(old.use_count(), 1);
+}
+
+TEST(Property, SnapshotReadersKeepTheirValueWhileWriterPublishes) {
+    PropertyRWSnapshot<std::vector<int>> values(std::vector<int>(64, 0));
+    std::atomic<bool> done{false};
+    std::atomic<int> changed{0};
+    RunThreads(4, [&](int t) {
+        if (t == 0) {
+            for (int i = 1; i <= 2000; ++i) {
+                values.Update([i](std::vector<int>& v) { std::fill(v.begin(), v.end(), i); });
+            }
+            done = true;
+            return;
+        }
+        while (!done) {
+            const auto snapshot = values();
+            const int first = snapshot->front();
+            std::this_thread::yield();
+            if (std::any_of(snapshot->begin(), snapshot->end(), [first](int v) { return v != first; })) {
+                ++changed;
+            }
+        }
+    });
+    EXPECT_EQ(changed, 0);
+    EXPECT_EQ(values()->back(), 2000);
+}
+
+TEST(Property, AtomicIncrementsAreNotLost) {
+    PropertyRWAtomic<int> counter(0);
+    RunThreads(8, [&](int) {
+        for (int i = 0; i < 10000; ++i) {
+            ++counter;
+            counter += 2;
+            counter -= 1;
+        }
+    });
+    EXPECT_EQ(counter, 8 * 20000);
+}
+
+TEST(Property, AtomicBitwiseOperatorsUseFetch) {
+    PropertyRWAtomic<std::uint32_t> flags(0);
+    RunThreads(32, [&](int t) { flags |= std::uint32_t(1) << t; });
+    EXPECT_EQ(flags, 0xFFFFFFFFu);
+    RunThreads(16, [&](int t) { flags &= ~(std::uint32_t(1) << (2 * t)); });
+    EXPECT_EQ(flags, 0xAAAAAAAAu);
+}
+
+TEST(Property, AtomicOperatorsWithoutFetchUseCompareAndSwap) {
+    // Multiplication has no fetch instruction, every thread doubles the value 10 times
+    PropertyRWAtomic<std::uint64_t> product(1);
+    RunThreads(4, [&](int) {
+        for (int i = 0; i < 10; ++i) {
+            product *= 2;
+        }
+    });
+    EXPECT_EQ(product, std::uint64_t(1) << 40);
+
+    PropertyRWAtomic<double> sum(0.0);
+    RunThreads(4, [&](int) {
+        for (int i = 0; i < 10000; ++i) {
+            sum += 1.0;
+        }
+    });
+    EXPECT_EQ(sum, 40000.0);
+}
+
+TEST(Property, GetterAndSetterAreReplaceableOnlyWhenDeclared) {
+    static_assert(!HasSetGetter<PropertyRW<int>>::value && !HasSetSetter<PropertyRW<int>>::value, "plain property has neither");
+    static_assert(!HasSetGetter<PropertyRWS<int>>::value && HasSetSetter<PropertyRWS<int>>::value, "setter only");
+    static_assert(HasSetGetter<PropertyROG<int>>::value && !HasSetSetter<PropertyROG<int>>::value, "read-only has no setter");
+    static_assert(HasSetGetter<PropertyRWGSMT<int>>::value && HasSetSetter<PropertyRWGSMT<int>>::value, "getter and setter");
+
+    PropertyRWGS<int> value(1, [](){ return 0; }, [](int) {});
+    int stored = 0;
+    value.SetGetter([&]() { return stored; });
+    value.SetSetter([&](int v) { stored = v + 1; });
+    value = 4;
+    EXPECT_EQ(value(), 5);
+}
+
+TEST(Property, MethodBindingsCallOwnerMembers) {
+    static_assert(sizeof(decltype(Account::Balance)) < sizeof(PropertyRWGS<int>), "member pointers are not stored in std::function");
+    Account account;
+    account.Balance = 12;
+    EXPECT_EQ(account.Balance.GetRaw(), 1200);
+    EXPECT_EQ(account.Balance(), 12);
+    EXPECT_EQ(account.GetterCalls, 1);
+    account.Balance = -3;
+    EXPECT_EQ(account.Balance.GetRaw(), 0);
+    account.Balance += 5;       // goes through getter and setter
+    EXPECT_EQ(account.Balance.GetRaw(), 500);
+    EXPECT_EQ(account.GetterCalls, 2);
+}
+
+TEST(Property, PaddedNeighboursUseSeparateCacheLines) {
+    PaddedCounters counters;
+    const auto line = [](const auto& property) {
+        return reinterpret_cast<std::uintptr_t>(&property) / detail::CacheLineSize;
+    };
+    EXPECT_NE(line(counters.First), line(counters.Second));
+    EXPECT_NE(line(counters.Second), line(counters.Third));
+    // Value and its mutex share the line of the property
+    EXPECT_EQ(line(detail::PropertyAccess::GetStorage(counters.First)), line(counters.First));
+
+    RunThreads(4, [&](int t) {
+        for (int i = 0; i < 10000; ++i) {
+            if (t % 2) {
+                counters.First += 1;
+            } else {
+                ++counters.Second;
+            }
+            counters.Third += 1;
+        }
+    });
+    EXPECT_EQ(counters.First, 20000);
+    EXPECT_EQ(counters.Second, 20000);
+    EXPECT_EQ(counters.Third, 40000);
+
+    // Padded policy keeps the recursive lock, the mutex can be re-entered
+    std::lock_guard<std::recursive_mutex> lock(detail::PropertyAccess::GetMutex(counters.First));
+    counters.First = 1;
+    EXPECT_EQ(counters.First, 1);
+}
+
+TEST(Property, RvaluesAreMovedNotCopied) {
+    PropertyRW<Tracked> plain;
+    PropertyRWMT<Tracked> locked;
+    Tracked::Reset();
+    plain = Tracked(1);
+    Tracked value(2);
+    locked = std::move(value);
+    detail::PropertyAccess::SetST(plain, Tracked(3));
+    EXPECT_EQ(Tracked::Copies, 0);
+    EXPECT_EQ(Tracked::Moves, 3);
+    EXPECT_EQ(plain().Value, 3);
+    EXPECT_EQ(locked().Value, 2);
+
+    // Setter receives the rvalue by reference
+    int received = 0;
+    PropertyRWS<Tracked> withSetter(Tracked(), [&](const Tracked& v) { received = v.Value; });
+    Tracked::Reset();
+    withSetter = Tracked(4);
+    EXPECT_EQ(Tracked::Copies, 0);
+    EXPECT_EQ(received, 4);
+
+    // Emplace constructs in the storage
+    Tracked::Reset();
+    plain.Emplace(5);
+    locked.Emplace(6);
+    EXPECT_EQ(Tracked::Copies + Tracked::Moves, 0);
+    EXPECT_EQ(plain().Value, 5);
+    EXPECT_EQ(locked().Value, 6);
+}
+
+TEST(Property, MoveOnlyValues) {
+    PropertyRWMT<std::unique_ptr<int>> owner;
+    owner = std::make_unique<int>(1);
+    EXPECT_EQ(*owner.GetRaw(), 1);
+    owner.Emplace(new int(2));
+    EXPECT_EQ(*owner.GetRaw(), 2);
+    detail::PropertyAccess::SetST(owner, std::unique_ptr<int>());
+    EXPECT_EQ(owner.GetRaw(), nullptr);
+}
+
+TEST(Property, PlainValuesAreModifiedInPlace) {
+    PropertyRW<Tracked> plain(Tracked(1));
+    PropertyRWMT<Tracked> locked(Tracked(1));
+    Tracked::Reset();
+    plain.Update([](Tracked& v) { v.Value += 2; });
+    locked.Update([](Tracked& v) { v.Value += 2; });
+    detail::PropertyAccess::ApplyST(plain, [](Tracked& v) { v.Value *= 10; });
+    EXPECT_EQ(Tracked::Copies + Tracked::Moves, 0);
+    EXPECT_EQ(plain().Value, 30);
+    EXPECT_EQ(locked().Value, 3);
+}
+
+TEST(Property, CompoundOperatorsGoThroughSetter) {
+    std::vector<int> received;
+    // Setter doesn't store, so every operator starts from the initial value
+    PropertyRWS<int> value(1, [&](int v) { received.push_back(v); });
+    value += 2;
+    value *= 4;
+    EXPECT_EQ(received, (std::vector<int>{3, 4}));
+
+    // Operation modifies a copy that is passed to the setter, the storage itself isn't touched
+    PropertyRWS<Tracked> tracked(Tracked(1), [&](const Tracked& v) { received.push_back(v.Value); });
+    Tracked::Reset();
+    tracked.Update([](Tracked& v) { v.Value = 7; });
+    EXPECT_EQ(Tracked::Copies, 1);
+    EXPECT_EQ(received.back(), 7);
+    EXPECT_EQ(tracked.GetRaw().Value, 1);
+}
+
+TEST(Property, SharedLockReadersOverlapWritersAreExclusive) {
+    PropertyRWSharedMT<LockProbe> probe;
+
+    LockProbe::WaitForPeer = true;
+    RunThreads(2, [&](int) { LockProbe copy = probe; (void)copy; });
+    EXPECT_EQ(LockProbe::MaxReaders, 2);
+
+    LockProbe::WaitForPeer = false;
+    RunThreads(4, [&](int t) {
+        LockProbe value;
+        for (int i = 0; i < 2000; ++i) {
+            if (t == 0) {
+                value.Value = i;
+                probe = value;
+            } else {
+                LockProbe copy = probe;
+                (void)copy;
+            }
+        }
+    });
+    EXPECT_FALSE(LockProbe::Overlap);
+}
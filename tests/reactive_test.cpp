@@ -0,0 +1,85 @@
+#include "propp/Reactive.hpp"
+
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <utility>
+#include <vector>
+
+using namespace propp;
+
+TEST(Reactive, DiamondIsRecomputedOnceWithoutGlitches) {
+    Reactive<PropertyRW<int>> a{1};
+    int bComputes = 0;
+    int cComputes = 0;
+    int dComputes = 0;
+    std::vector<std::pair<int, int>> seen;
+    PropertyComputed<int> b([&]() { ++bComputes; return a() * 2; });
+    PropertyComputed<int> c([&]() { ++cComputes; return a() + 10; });
+    PropertyComputed<int> d([&]() { ++dComputes; seen.emplace_back(b(), c()); return b() + c(); });
+    b.DependsOn(a);
+    c.DependsOn(a);
+    d.DependsOn(b).DependsOn(c);
+
+    EXPECT_EQ(d(), 13);
+    a = 5;
+    EXPECT_EQ(dComputes, 1);
+    EXPECT_EQ(d(), 25);
+    EXPECT_EQ(d(), 25);
+    EXPECT_EQ(bComputes, 2);
+    EXPECT_EQ(cComputes, 2);
+    EXPECT_EQ(dComputes, 2);
+    for (const auto& inputs : seen) {
+        EXPECT_EQ(inputs.first / 2 + 10, inputs.second);
+    }
+}
+
+TEST(Reactive, UnrelatedNodesAreNotRecomputed) {
+    Reactive<PropertyRW<int>> a{1};
+    Reactive<PropertyRW<int>> e{0};
+    int bComputes = 0;
+    int fComputes = 0;
+    PropertyComputed<int> b([&]() { ++bComputes; return a() * 2; });
+    PropertyComputed<int> f([&]() { ++fComputes; return e() + 1; });
+    b.DependsOn(a);
+    f.DependsOn(e);
+    EXPECT_EQ(b(), 2);
+    EXPECT_EQ(f(), 1);
+    e = 3;
+    EXPECT_EQ(b(), 2);
+    EXPECT_EQ(f(), 4);
+    EXPECT_EQ(bComputes, 1);
+    EXPECT_EQ(fComputes, 2);
+}
+
+TEST(Reactive, LongChainPropagates) {
+    constexpr int Length = 5000;
+    Reactive<PropertyRW<long>> source{1};
+    std::deque<PropertyComputed<long>> chain;
+    for (int i = 0; i < Length; ++i) {
+        if (i == 0) {
+            chain.emplace_back([&source]() { return source() + 1; });
+            chain.back().DependsOn(source);
+        } else {
+            PropertyComputed<long>* previous = &chain.back();
+            chain.emplace_back([previous]() { return (*previous)() + 1; });
+            chain.back().DependsOn(*previous);
+        }
+    }
+    EXPECT_EQ(chain.back()(), Length + 1);
+    for (int i = 0; i < 10; ++i) {
+        source = i;
+        EXPECT_EQ(chain.back()(), i + Length);
+    }
+}
+
+TEST(Reactive, NodeDestroyedBeforeSource) {
+    Reactive<PropertyRWMT<int>> x{2};
+    {
+        PropertyComputedMT<int> square([&]() { return x() * x(); });
+        square.DependsOn(x);
+        EXPECT_EQ(square(), 4);
+    }
+    x = 3;
+    EXPECT_EQ(x, 3);
+}
@@ -0,0 +1,92 @@
+#include "propp/Reflect.hpp"
+#include "propp/Observer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace propp;
+
+namespace app {
+
+struct Point {
+    float x;
+    float y;
+};
+
+struct Address {
+    PropertyRW<std::string> Street;
+    PropertyRW<int> Number;
+};
+PROPP_REFLECT(Address, Street, Number)
+
+struct Person {
+    int GetterCalls = 0;
+    PropertyRWG<std::string> Name{"", [this]() { ++GetterCalls; return std::string("x"); }};
+    PropertyRO<int> Id{0};
+    PropertyRWAtomic<int> Age;
+    PropertyRWSnapshot<std::vector<std::string>> Tags;
+    PropertyRWSeqLock<Point> Position;
+    Address Home;
+    std::vector<Point> Path;
+    Observed<PropertyRWMT<double>> Score;
+};
+PROPP_REFLECT(Person, Name, Id, Age, Tags, Position, Home, Path, Score)
+
+} // namespace app
+
+static_assert(FieldCount<app::Person> == 8, "Person has 8 reflected fields");
+static_assert(IsReflected<app::Person> && !IsReflected<int>, "Only reflected types are reflected");
+
+TEST(Reflect, RoundTripSkipsGetters) {
+    app::Person a;
+    detail::PropertyAccess::GetStorage(a.Name) = "Alice";
+    detail::PropertyAccess::GetStorage(a.Id) = 7;
+    a.Age = 33;
+    a.Tags = std::vector<std::string>{"a", "bc"};
+    a.Position = app::Point{1.5f, 2.5f};
+    a.Home.Street = "Main";
+    a.Home.Number = 12;
+    a.Path = {{1, 2}, {3, 4}};
+    a.Score = 9.5;
+    auto buffer = Serialize(a);
+    EXPECT_EQ(a.GetterCalls, 0);
+
+    app::Person b;
+    int changes = 0;
+    auto subscription = b.Score.Subscribe([&](const double&) { ++changes; });
+    ASSERT_TRUE(Deserialize(b, buffer));
+    EXPECT_EQ(detail::PropertyAccess::GetStorage(b.Name), "Alice");
+    EXPECT_EQ(b.Id, 7);
+    EXPECT_EQ(b.Age, 33);
+    EXPECT_EQ((*b.Tags())[1], "bc");
+    EXPECT_EQ(b.Position().y, 2.5f);
+    EXPECT_EQ(b.Home.Street(), "Main");
+    EXPECT_EQ(b.Home.Number, 12);
+    EXPECT_EQ(b.Path.size(), 2u);
+    EXPECT_EQ(b.Score, 9.5);
+    EXPECT_EQ(changes, 1);
+}
+
+TEST(Reflect, TruncatedOrOversizedInputIsRejected) {
+    app::Person a;
+    a.Home.Street = "Main";
+    auto buffer = Serialize(a);
+    for (std::size_t size = 0; size < buffer.size(); ++size) {
+        app::Person b;
+        EXPECT_FALSE(Deserialize(b, buffer.data(), size));
+    }
+    buffer.push_back(0);
+    app::Person b;
+    EXPECT_FALSE(Deserialize(b, buffer));
+}
+
+TEST(Reflect, ForEachFieldVisitsInOrder) {
+    app::Person person;
+    std::vector<std::string> names;
+    ForEachField(person, [&](const char* name, auto&) { names.push_back(name); });
+    ASSERT_EQ(names.size(), 8u);
+    EXPECT_EQ(names.front(), "Name");
+    EXPECT_EQ(names.back(), "Score");
+}
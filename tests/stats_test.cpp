@@ -0,0 +1,91 @@
+#include "propp/Property.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace propp;
+
+namespace {
+
+PropertyStatsRecord Find(const std::string& name) {
+    for (const PropertyStatsRecord& record : StatsRegistry::Instance().Records()) {
+        if (record.Name == name) {
+            return record;
+        }
+    }
+    ADD_FAILURE() << "no record " << name;
+    return {};
+}
+
+} // namespace
+
+TEST(Stats, CountsReadsAndWrites) {
+    PropertyRWMT<int> a(0);
+    a.StatsName("reads_and_writes");
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&]() {
+            for (int i = 0; i < 1000; ++i) {
+                a += 1;
+                (void)a();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const PropertyStatsRecord record = Find("reads_and_writes");
+    EXPECT_EQ(record.Writes, 4000u);
+    EXPECT_EQ(record.Reads, 4000u);
+}
+
+TEST(Stats, SharedNameIsCountedTogether) {
+    PropertyRWMT<int> first;
+    PropertyRWMT<int> second;
+    first.StatsName("shared");
+    second.StatsName("shared");
+    first = 1;
+    second = 2;
+    (void)first();
+    const PropertyStatsRecord record = Find("shared");
+    EXPECT_EQ(record.Writes, 2u);
+    EXPECT_EQ(record.Reads, 1u);
+}
+
+TEST(Stats, SetterAssigningPropertyIsCountedOnce) {
+    PropertyRWSMT<int> clamped;
+    clamped.SetSetter([&](int v) { clamped = v < 0 ? 0 : v; });
+    clamped.StatsName("setter_write");
+    clamped = 5;
+    clamped = -5;
+    const PropertyStatsRecord record = Find("setter_write");
+    EXPECT_EQ(record.Writes, 2u);
+    EXPECT_EQ(record.SetterCalls, 2u);
+}
+
+TEST(Stats, UnnamedPropertyIsDroppedWithIt) {
+    const std::size_t before = StatsRegistry::Instance().Records().size();
+    {
+        PropertyRWMT<int> temporary;
+        EXPECT_EQ(StatsRegistry::Instance().Records().size(), before + 1);
+    }
+    EXPECT_EQ(StatsRegistry::Instance().Records().size(), before);
+}
+
+TEST(Stats, PlainPropertiesStayConstexpr) {
+    struct Endpoint {
+        PropertyRO<int> Port;
+        PropertyRO<bool> Tls;
+    };
+    static constexpr Endpoint endpoints[] = { {80, false}, {443, true} };
+    static_assert(endpoints[1].Port == 443, "plain properties must be constant-initialized with stats");
+    static_assert(sizeof(PropertyRW<int>) == sizeof(int), "plain properties must not carry stats");
+
+    const std::size_t before = StatsRegistry::Instance().Records().size();
+    PropertyRW<int> plain(1);
+    EXPECT_EQ(StatsRegistry::Instance().Records().size(), before);
+    EXPECT_TRUE(endpoints[1].Tls);
+}
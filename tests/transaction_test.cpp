@@ -0,0 +1,136 @@
+#include "propp/Transaction.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace propp;
+
+namespace {
+
+struct Body {
+    PropertyRWMT<int> X{0};
+    PropertyRWMT<int> Y{0};
+    PropertyRWSMT<int> Age{0, [this](int v) { Age = std::clamp(v, 0, 150); }};
+    WithLock<PropertyRWMT<int>, SharedLock> Z{0};
+};
+
+// Mutex that counts how often it is locked and held and may refuse to lock
+struct FlakyMutex {
+    int Held = 0;
+    int Locks = 0;
+    int Unlocks = 0;
+    bool Throws = false;
+
+    void lock() {
+        if (Throws) {
+            throw std::runtime_error("lock failed");
+        }
+        ++Locks;
+        ++Held;
+    }
+    bool try_lock() {
+        lock();
+        return true;
+    }
+    void unlock() {
+        ++Unlocks;
+        --Held;
+    }
+};
+
+struct FlakyLock {
+    using Mutex = FlakyMutex;
+    using ReadLock = std::lock_guard<Mutex>;
+};
+
+using FlakyProperty = Property<int, false, true, NoGetter, NoSetter, FlakyLock>;
+
+// Members are locked in address order, so First is locked before Second
+struct FlakyPair {
+    FlakyProperty First{0};
+    FlakyProperty Second{0};
+};
+
+} // namespace
+
+TEST(Transaction, WritesAreSeenTogether) {
+    Body body;
+    std::atomic<int> torn{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < 5000; ++i) {
+                if (t % 2) {
+                    Transaction tx(body.X, body.Y, body.Z);
+                    tx.Set(body.X, tx.Get(body.X) + 1);
+                    tx.Apply(body.Y, [](int& v) { ++v; });
+                    tx.Apply(body.Z, [](int& v) { ++v; });
+                } else {
+                    // Same properties in another order must not deadlock
+                    Transaction tx(body.Z, body.Y, body.X);
+                    if (tx.Get(body.X) != tx.Get(body.Y)) {
+                        ++torn;
+                    }
+                    tx.Apply(body.X, [](int& v) { ++v; });
+                    tx.Apply(body.Y, [](int& v) { ++v; });
+                    tx.Apply(body.Z, [](int& v) { ++v; });
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(torn, 0);
+    EXPECT_EQ(body.X, 20000);
+    EXPECT_EQ(body.Y, 20000);
+    EXPECT_EQ(body.Z, 20000);
+}
+
+TEST(Transaction, InvokesSetters) {
+    Body body;
+    {
+        Transaction tx(body.Age, body.X);
+        tx.Set(body.Age, 500);
+    }
+    EXPECT_EQ(body.Age, 150);
+}
+
+TEST(Transaction, SameMutexIsLockedOnce) {
+    FlakyProperty value(0);
+    PropertyRW<int> local(0);
+    const FlakyMutex& mutex = detail::PropertyAccess::GetMutex(value);
+    {
+        Transaction tx(value, value, local);
+        EXPECT_EQ(mutex.Locks, 1);
+        tx.Set(local, 3);
+        tx.Set(value, 4);
+        tx.Apply(value, [](int& v) { ++v; });
+        EXPECT_EQ(mutex.Locks, 1);
+    }
+    EXPECT_EQ(mutex.Locks, 1);
+    EXPECT_EQ(mutex.Unlocks, 1);
+    EXPECT_EQ(local, 3);
+    EXPECT_EQ(value.GetRaw(), 5);
+}
+
+TEST(Transaction, FailedLockReleasesTakenMutexes) {
+    FlakyPair pair;
+    detail::PropertyAccess::GetMutex(pair.Second).Throws = true;
+    EXPECT_THROW(Transaction tx(pair.Second, pair.First), std::runtime_error);
+    EXPECT_EQ(detail::PropertyAccess::GetMutex(pair.First).Held, 0);
+
+    detail::PropertyAccess::GetMutex(pair.Second).Throws = false;
+    {
+        Transaction tx(pair.First, pair.Second);
+        EXPECT_EQ(detail::PropertyAccess::GetMutex(pair.First).Held, 1);
+        EXPECT_EQ(detail::PropertyAccess::GetMutex(pair.Second).Held, 1);
+    }
+    EXPECT_EQ(detail::PropertyAccess::GetMutex(pair.First).Held, 0);
+    EXPECT_EQ(detail::PropertyAccess::GetMutex(pair.Second).Held, 0);
+}